@@ -23,9 +23,9 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/TLV.h>
+#include <lib/core/TLVContainerIndex.h>
 #include <lib/core/TLVTags.h>
 #include <lib/core/TLVTypes.h>
-#include <lib/core/TLVUtilities.h>
 #include <lib/support/Span.h>
 
 /* Device attestation key ids */
@@ -180,6 +180,8 @@ CHIP_ERROR ExampleSe05xDACProviderv2::SignWithDeviceAttestationKey(const ByteSpa
 
     TLV::TLVReader msg_reader;
     TLV::TLVReader tagReader;
+    // Attestation elements hold at most 4 members plus 3 vendor reserved elements
+    TLV::TLVContainerIndex<7> msg_index;
 
     msg_reader.Init(message_to_sign);
 
@@ -189,13 +191,16 @@ CHIP_ERROR ExampleSe05xDACProviderv2::SignWithDeviceAttestationKey(const ByteSpa
         0,
     };
 
+    SuccessOrExit(err = msg_reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    SuccessOrExit(err = msg_index.Build(msg_reader));
+
     tempBuf[0] = (uint8_t) TLV::TLVElementType::Structure;
     SuccessOrExit(err = se05xSetCertificate(START_CONTAINER_SE05X_ID, tempBuf, 1));
 
     for (int i = 1; i <= NO_OF_DEV_ATTEST_MSG_TAGS_TO_PARSE; i++)
     {
         CHIP_ERROR tlverr = CHIP_NO_ERROR;
-        tlverr            = TLV::Utilities::Find(msg_reader, TLV::ContextTag(i), tagReader);
+        tlverr            = msg_index.Find(TLV::ContextTag(i), tagReader);
         if ((i == 3) && (tlverr == CHIP_ERROR_TLV_TAG_NOT_FOUND))
         {
             continue;
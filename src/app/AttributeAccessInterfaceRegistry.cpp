@@ -69,21 +69,21 @@ AttributeAccessInterfaceRegistry & AttributeAccessInterfaceRegistry::Instance()
 
 void AttributeAccessInterfaceRegistry::Unregister(AttributeAccessInterface * attrOverride)
 {
-    mAttributeAccessInterfaceCache.Invalidate();
+    OnRegistrationsChanged();
     UnregisterMatchingAttributeAccessInterfaces([attrOverride](AttributeAccessInterface * entry) { return entry == attrOverride; },
                                                 mAttributeAccessOverrides);
 }
 
 void AttributeAccessInterfaceRegistry::UnregisterAllForEndpoint(EndpointId endpointId)
 {
-    mAttributeAccessInterfaceCache.Invalidate();
+    OnRegistrationsChanged();
     UnregisterMatchingAttributeAccessInterfaces(
         [endpointId](AttributeAccessInterface * entry) { return entry->MatchesEndpoint(endpointId); }, mAttributeAccessOverrides);
 }
 
 bool AttributeAccessInterfaceRegistry::Register(AttributeAccessInterface * attrOverride)
 {
-    mAttributeAccessInterfaceCache.Invalidate();
+    OnRegistrationsChanged();
     for (auto * cur = mAttributeAccessOverrides; cur; cur = cur->GetNext())
     {
         if (cur->Matches(*attrOverride))
@@ -101,6 +101,17 @@ AttributeAccessInterface * AttributeAccessInterfaceRegistry::Get(EndpointId endp
 {
     using CacheResult = AttributeAccessInterfaceCache::CacheResult;
 
+    if (mIndex.IsAvailable(
+            mAttributeAccessOverrides, [](AttributeAccessInterface * entry) { return entry->GetNext(); },
+            [](AttributeAccessInterface * entry, Optional<EndpointId> & entryEndpointId, ClusterId & entryClusterId) {
+                entryEndpointId = entry->mEndpointId;
+                entryClusterId  = entry->mClusterId;
+            }))
+    {
+        return mIndex.Find(endpointId, clusterId);
+    }
+
+    // No usable index (indexing disabled or too many interfaces): search the list, remembering the last results
     AttributeAccessInterface * cached = nullptr;
     CacheResult result                = mAttributeAccessInterfaceCache.Get(endpointId, clusterId, &cached);
     switch (result)
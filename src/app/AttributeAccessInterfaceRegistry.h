@@ -17,6 +17,7 @@
 
 #include <app/AttributeAccessInterface.h>
 #include <app/AttributeAccessInterfaceCache.h>
+#include <app/InterfaceRegistryIndex.h>
 
 namespace chip {
 namespace app {
@@ -57,7 +58,16 @@ public:
 
 private:
     AttributeAccessInterface * mAttributeAccessOverrides = nullptr;
+    InterfaceRegistryIndex<AttributeAccessInterface> mIndex;
+
+    // Only used when mIndex is not usable
     AttributeAccessInterfaceCache mAttributeAccessInterfaceCache;
+
+    void OnRegistrationsChanged()
+    {
+        mIndex.Invalidate();
+        mAttributeAccessInterfaceCache.Invalidate();
+    }
 };
 
 } // namespace app
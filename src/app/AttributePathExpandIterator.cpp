@@ -59,7 +59,7 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttributeId()
     {
         if (mpAttributePath->mValue.HasWildcardAttributeId())
         {
-            AttributeEntry entry = mDataModelProvider->FirstAttribute(mOutputPath);
+            AttributeEntry entry = mDataModelProvider->FirstAttributeWithCursor(mOutputPath, mAttributeCursor);
             return entry.IsValid()                                         //
                 ? entry.path.mAttributeId                                  //
                 : Clusters::Globals::Attributes::GeneratedCommandList::Id; //
@@ -97,7 +97,7 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttributeId()
         return std::nullopt;
     }
 
-    AttributeEntry entry = mDataModelProvider->NextAttribute(mOutputPath);
+    AttributeEntry entry = mDataModelProvider->NextAttributeWithCursor(mOutputPath, mAttributeCursor);
     if (entry.IsValid())
     {
         return entry.path.mAttributeId;
@@ -115,7 +115,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     {
         if (mpAttributePath->mValue.HasWildcardClusterId())
         {
-            ClusterEntry entry = mDataModelProvider->FirstServerCluster(mOutputPath.mEndpointId);
+            ClusterEntry entry = mDataModelProvider->FirstServerClusterWithCursor(mOutputPath.mEndpointId, mClusterCursor);
             return entry.IsValid() ? std::make_optional(entry.path.mClusterId) : std::nullopt;
         }
 
@@ -131,7 +131,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
 
     VerifyOrReturnValue(mpAttributePath->mValue.HasWildcardClusterId(), std::nullopt);
 
-    ClusterEntry entry = mDataModelProvider->NextServerCluster(mOutputPath);
+    ClusterEntry entry = mDataModelProvider->NextServerClusterWithCursor(mOutputPath, mClusterCursor);
     return entry.IsValid() ? std::make_optional(entry.path.mClusterId) : std::nullopt;
 }
 
@@ -141,7 +141,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextEndpointId()
     {
         if (mpAttributePath->mValue.HasWildcardEndpointId())
         {
-            EndpointEntry ep = mDataModelProvider->FirstEndpoint();
+            EndpointEntry ep = mDataModelProvider->FirstEndpointWithCursor(mEndpointCursor);
             return (ep.id != kInvalidEndpointId) ? std::make_optional(ep.id) : std::nullopt;
         }
 
@@ -150,7 +150,7 @@ std::optional<ClusterId> AttributePathExpandIterator::NextEndpointId()
 
     VerifyOrReturnValue(mpAttributePath->mValue.HasWildcardEndpointId(), std::nullopt);
 
-    EndpointEntry ep = mDataModelProvider->NextEndpoint(mOutputPath.mEndpointId);
+    EndpointEntry ep = mDataModelProvider->NextEndpointWithCursor(mOutputPath.mEndpointId, mEndpointCursor);
     return (ep.id != kInvalidEndpointId) ? std::make_optional(ep.id) : std::nullopt;
 }
 
@@ -93,6 +93,12 @@ private:
     SingleLinkedListNode<AttributePathParams> * mpAttributePath;
     ConcreteAttributePath mOutputPath;
 
+    // Positions of the endpoint, cluster and attribute iterations that produced mOutputPath, so that
+    // advancing does not depend on the data model provider remembering them across interleaved iterators.
+    DataModel::MetadataCursor mEndpointCursor;
+    DataModel::MetadataCursor mClusterCursor;
+    DataModel::MetadataCursor mAttributeCursor;
+
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath
     ///
@@ -0,0 +1,115 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/AttributeUpdateQueue.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <mutex>
+#include <string.h>
+#include <utility>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR AttributeUpdateQueue::Init()
+{
+    VerifyOrReturnError(mPending.size() == mDraining.size(), CHIP_ERROR_INVALID_ARGUMENT);
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    if (!mLockInitialized)
+    {
+        ReturnErrorOnFailure(System::Mutex::Init(mLock));
+        mLockInitialized = true;
+    }
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AttributeUpdateQueue::Enqueue(const ConcreteAttributePath & path, EmberAfAttributeType type, ByteSpan value)
+{
+    VerifyOrReturnError(value.size() <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    bool scheduleDrain;
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+
+        Update * update = nullptr;
+        for (size_t i = 0; i < mPendingCount; i++)
+        {
+            if (mPending[i].path == path)
+            {
+                update = &mPending[i];
+                mCoalescedCount++;
+                break;
+            }
+        }
+
+        if (update == nullptr)
+        {
+            VerifyOrReturnError(mPendingCount < mPending.size(), CHIP_ERROR_NO_MEMORY);
+            update       = &mPending[mPendingCount++];
+            update->path = path;
+        }
+
+        update->type        = type;
+        update->valueLength = static_cast<uint8_t>(value.size());
+        memcpy(update->value, value.data(), value.size());
+
+        scheduleDrain   = !mDrainScheduled;
+        mDrainScheduled = true;
+    }
+
+    // Not holding the lock: the delegate may end up taking the Matter stack lock.
+    VerifyOrReturnError(scheduleDrain, CHIP_NO_ERROR);
+    CHIP_ERROR err = mDelegate.ScheduleDrain(*this);
+    if (err != CHIP_NO_ERROR)
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        mDrainScheduled = false;
+    }
+    return err;
+}
+
+size_t AttributeUpdateQueue::Drain()
+{
+    Span<Update> batch;
+    {
+        std::lock_guard<System::Mutex> lock(mLock);
+        batch = mPending.SubSpan(0, mPendingCount);
+        std::swap(mPending, mDraining);
+        mPendingCount   = 0;
+        mDrainScheduled = false;
+    }
+
+    // Producers queue into the other buffer meanwhile. It only gets swapped back by the next
+    // drain, which runs on this same thread, so the batch is not modified while being applied.
+    for (const Update & update : batch)
+    {
+        mDelegate.ApplyUpdate(update);
+    }
+
+    mAppliedCount += batch.size();
+    return batch.size();
+}
+
+size_t AttributeUpdateQueue::GetCoalescedUpdateCount()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mCoalescedCount;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/util/attribute-metadata.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <system/SystemMutex.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/// Hands attribute value updates over from application threads (e.g. sensor or device driver
+/// threads) to the Matter thread.
+///
+/// Producers call `Enqueue` from any thread without taking the Matter stack lock: the queue has
+/// its own lock, only held while copying the value in. The queued updates are applied in batches
+/// by `Drain` on the Matter thread, and only the latest value of each attribute is kept until
+/// then, so an attribute updated many times between two drains is only written (and marked dirty
+/// for reporting) once.
+///
+/// Updates of different attributes are applied in the order they were first queued.
+class AttributeUpdateQueue
+{
+public:
+    /// Large enough for the value of any numeric, boolean, enum or bitmap attribute.
+    static constexpr size_t kMaxValueSize = 8;
+
+    struct Update
+    {
+        ConcreteAttributePath path;
+        EmberAfAttributeType type = 0;
+        uint8_t valueLength       = 0;
+        uint8_t value[kMaxValueSize];
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /// Called from the producing thread when updates get queued while no drain is scheduled.
+        /// Has to arrange for `queue.Drain()` to be called on the Matter thread.
+        virtual CHIP_ERROR ScheduleDrain(AttributeUpdateQueue & queue) = 0;
+
+        /// Called by `Drain` for each queued update.
+        virtual void ApplyUpdate(const Update & update) = 0;
+    };
+
+    /// Updates are queued into one of the buffers while the updates in the other one are
+    /// applied, so both have to have the same size.
+    AttributeUpdateQueue(Delegate & delegate, Span<Update> pending, Span<Update> draining) :
+        mDelegate(delegate), mPending(pending), mDraining(draining)
+    {}
+
+    AttributeUpdateQueue(const AttributeUpdateQueue &)             = delete;
+    AttributeUpdateQueue & operator=(const AttributeUpdateQueue &) = delete;
+
+    /// Must be called before any thread enqueues updates.
+    CHIP_ERROR Init();
+
+    /// Queues `value`, in the attribute storage format expected by emberAfWriteAttribute, as the
+    /// new value of the attribute at `path`, replacing any value already queued for it.
+    ///
+    /// Returns CHIP_ERROR_NO_MEMORY if the queue is full and CHIP_ERROR_INVALID_ARGUMENT if the
+    /// value is larger than kMaxValueSize. If scheduling the drain fails, the error is returned
+    /// but the update stays queued and will be applied by the next drain.
+    CHIP_ERROR Enqueue(const ConcreteAttributePath & path, EmberAfAttributeType type, ByteSpan value);
+
+    /// Applies all queued updates through the delegate and returns how many there were.
+    ///
+    /// Must only be called from a single thread (the Matter thread).
+    size_t Drain();
+
+    /// Number of queued values that were replaced by a later value of the same attribute.
+    size_t GetCoalescedUpdateCount();
+
+    /// Number of updates applied by `Drain`.
+    size_t GetAppliedUpdateCount() const { return mAppliedCount; }
+
+private:
+    Delegate & mDelegate;
+
+    System::Mutex mLock;
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    bool mLockInitialized = false;
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+    // Protected by mLock
+    Span<Update> mPending;
+    Span<Update> mDraining;
+    size_t mPendingCount   = 0;
+    bool mDrainScheduled   = false;
+    size_t mCoalescedCount = 0;
+
+    // Only used by Drain
+    size_t mAppliedCount = 0;
+};
+
+template <size_t kCapacity>
+class AttributeUpdateQueueWithStorage : public AttributeUpdateQueue
+{
+public:
+    explicit AttributeUpdateQueueWithStorage(Delegate & delegate) :
+        AttributeUpdateQueue(delegate, Span<Update>(mBuffers[0]), Span<Update>(mBuffers[1]))
+    {}
+
+private:
+    Update mBuffers[2][kCapacity];
+};
+
+} // namespace app
+} // namespace chip
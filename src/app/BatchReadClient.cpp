@@ -0,0 +1,339 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a client that reads or subscribes to the same paths on many nodes.
+ *
+ */
+
+#include <app/BatchReadClient.h>
+
+#include <app/CASESessionManager.h>
+#include <app/InteractionModelEngine.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SessionManager.h>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+namespace {
+
+// Copies everything but the session, which is per-node.
+void CopyReadPrepareParams(const ReadPrepareParams & aSource, ReadPrepareParams & aDestination)
+{
+    aDestination.mpEventPathParamsList        = aSource.mpEventPathParamsList;
+    aDestination.mEventPathParamsListSize     = aSource.mEventPathParamsListSize;
+    aDestination.mpAttributePathParamsList    = aSource.mpAttributePathParamsList;
+    aDestination.mAttributePathParamsListSize = aSource.mAttributePathParamsListSize;
+    aDestination.mpDataVersionFilterList      = aSource.mpDataVersionFilterList;
+    aDestination.mDataVersionFilterListSize   = aSource.mDataVersionFilterListSize;
+    aDestination.mEventNumber                 = aSource.mEventNumber;
+    aDestination.mTimeout                     = aSource.mTimeout;
+    aDestination.mMinIntervalFloorSeconds     = aSource.mMinIntervalFloorSeconds;
+    aDestination.mMaxIntervalCeilingSeconds   = aSource.mMaxIntervalCeilingSeconds;
+    aDestination.mKeepSubscriptions           = aSource.mKeepSubscriptions;
+    aDestination.mIsFabricFiltered            = aSource.mIsFabricFiltered;
+    aDestination.mIsPeerLIT                   = aSource.mIsPeerLIT;
+}
+
+} // namespace
+
+BatchReadClient::BatchReadClient(InteractionModelEngine * apImEngine, Messaging::ExchangeManager * apExchangeMgr,
+                                 Callback & aCallback, ReadClient::InteractionType aInteractionType) :
+    mpImEngine(apImEngine),
+    mpExchangeMgr(apExchangeMgr), mCallback(aCallback), mInteractionType(aInteractionType)
+{}
+
+BatchReadClient::~BatchReadClient()
+{
+    if (mBatchDoneQueued)
+    {
+        mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(HandleBatchDone, this);
+    }
+    ReleaseNodes();
+}
+
+void BatchReadClient::ReleaseNodes()
+{
+    while (mpNodes != nullptr)
+    {
+        Node * next = mpNodes->mpNext;
+        mpNodes->Cancel();
+        Platform::Delete(mpNodes);
+        mpNodes = next;
+    }
+
+    mpNextPending = nullptr;
+    mNodeCount    = 0;
+    mSettledCount = 0;
+    mFailedCount  = 0;
+    mInFlight     = 0;
+}
+
+CHIP_ERROR BatchReadClient::SendRequest(Span<const ScopedNodeId> aNodes, const ReadPrepareParams & aReadPrepareParams,
+                                        size_t aMaxConcurrentSetups)
+{
+    VerifyOrReturnError(mpNodes == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!aNodes.empty() && aMaxConcurrentSetups > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aReadPrepareParams.mAttributePathParamsListSize != 0 || aReadPrepareParams.mEventPathParamsListSize != 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Each node gets one interaction and one status, so a node listed twice is most likely a mistake of the caller.
+    for (size_t i = 1; i < aNodes.size(); i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            VerifyOrReturnError(aNodes[i] != aNodes[j], CHIP_ERROR_INVALID_ARGUMENT);
+        }
+    }
+
+    // Allocate everything up front, so that running out of memory fails the whole request rather than
+    // leaving some nodes out.
+    Node ** tail = &mpNodes;
+    for (const auto & peer : aNodes)
+    {
+        Node * node = Platform::New<Node>(*this, peer);
+        if (node == nullptr)
+        {
+            ReleaseNodes();
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        *tail = node;
+        tail  = &node->mpNext;
+        mNodeCount++;
+    }
+
+    CopyReadPrepareParams(aReadPrepareParams, mReadPrepareParams);
+    mpNextPending = mpNodes;
+    mMaxInFlight  = aMaxConcurrentSetups;
+
+    ChipLogProgress(DataManagement, "Starting batch %s of %u nodes, %u at a time",
+                    mInteractionType == ReadClient::InteractionType::Subscribe ? "subscription" : "read",
+                    static_cast<unsigned>(mNodeCount), static_cast<unsigned>(mMaxInFlight));
+
+    StartPendingNodes();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BatchReadClient::GetNodeStatus(const ScopedNodeId & aNode) const
+{
+    for (const Node * node = mpNodes; node != nullptr; node = node->mpNext)
+    {
+        if (node->mPeer == aNode)
+        {
+            return (node->mState == NodeState::kSettled) ? node->mStatus : CHIP_ERROR_BUSY;
+        }
+    }
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+void BatchReadClient::StartPendingNodes()
+{
+    // Nodes can settle synchronously while being started (e.g. if a session already exists and sending fails), which
+    // calls back in here.  Only the outermost call starts nodes and reports the completion of the batch.
+    VerifyOrReturn(!mStartingNodes);
+    mStartingNodes = true;
+
+    while (mInFlight < mMaxInFlight && mpNextPending != nullptr)
+    {
+        Node * node   = mpNextPending;
+        mpNextPending = node->mpNext;
+        mInFlight++;
+        node->Connect();
+    }
+
+    mStartingNodes = false;
+
+    VerifyOrReturn(mSettledCount == mNodeCount);
+
+    // The last node settles from within a ReadClient (or session setup) callback, which still uses the node after we
+    // return: report the completion from the event loop, where OnBatchDone is free to destroy us.
+    CHIP_ERROR err = mpExchangeMgr->GetSessionManager()->SystemLayer()->StartTimer(System::Clock::kZero, HandleBatchDone, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule the completion of the batch: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mBatchDoneQueued = true;
+}
+
+void BatchReadClient::HandleBatchDone(System::Layer * aSystemLayer, void * aAppState)
+{
+    auto * const _this = static_cast<BatchReadClient *>(aAppState);
+
+    _this->mBatchDoneQueued = false;
+
+    ChipLogProgress(DataManagement, "Batch of %u nodes done, %u failed", static_cast<unsigned>(_this->mNodeCount),
+                    static_cast<unsigned>(_this->mFailedCount));
+    // This may destroy us, so it has to be the last thing we do.
+    _this->mCallback.OnBatchDone(*_this);
+}
+
+void BatchReadClient::OnNodeStatus(Node & aNode, CHIP_ERROR aError)
+{
+    const bool firstStatus = (aNode.mState != NodeState::kSettled);
+
+    aNode.mState  = NodeState::kSettled;
+    aNode.mStatus = aError;
+    mCallback.OnNodeStatus(aNode.mPeer, aError);
+
+    VerifyOrReturn(firstStatus);
+
+    mSettledCount++;
+    mInFlight--;
+    if (aError != CHIP_NO_ERROR)
+    {
+        mFailedCount++;
+    }
+
+    StartPendingNodes();
+}
+
+BatchReadClient::Node::Node(BatchReadClient & aBatch, const ScopedNodeId & aPeer) :
+    mBatch(aBatch), mPeer(aPeer), mOnConnectedCallback(HandleDeviceConnected, this),
+    mOnConnectionFailureCallback(HandleDeviceConnectionFailure, this)
+{}
+
+void BatchReadClient::Node::Connect()
+{
+    mState = NodeState::kConnecting;
+
+    auto session = mBatch.mpExchangeMgr->GetSessionManager()->FindSecureSessionForNode(
+        mPeer, MakeOptional(Transport::SecureSession::Type::kCASE));
+    if (session.HasValue())
+    {
+        SendRequest(session.Value());
+        return;
+    }
+
+    auto * caseSessionManager = mBatch.mpImEngine->GetCASESessionManager();
+    if (caseSessionManager == nullptr)
+    {
+        mBatch.OnNodeStatus(*this, CHIP_ERROR_NOT_CONNECTED);
+        return;
+    }
+
+    caseSessionManager->FindOrEstablishSession(mPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback);
+}
+
+void BatchReadClient::Node::Cancel()
+{
+    mOnConnectedCallback.Cancel();
+    mOnConnectionFailureCallback.Cancel();
+    mReadClient.reset();
+}
+
+void BatchReadClient::Node::SendRequest(const SessionHandle & aSessionHandle)
+{
+    mState = NodeState::kRequesting;
+
+    mReadClient = Platform::MakeUnique<ReadClient>(mBatch.mpImEngine, mBatch.mpExchangeMgr, *this, mBatch.mInteractionType);
+    if (!mReadClient)
+    {
+        mBatch.OnNodeStatus(*this, CHIP_ERROR_NO_MEMORY);
+        return;
+    }
+
+    ReadPrepareParams params(aSessionHandle);
+    CopyReadPrepareParams(mBatch.mReadPrepareParams, params);
+
+    CHIP_ERROR err;
+    if (mBatch.mInteractionType == ReadClient::InteractionType::Subscribe)
+    {
+        err = mReadClient->SendAutoResubscribeRequest(std::move(params));
+    }
+    else
+    {
+        err = mReadClient->SendRequest(params);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mReadClient.reset();
+        mBatch.OnNodeStatus(*this, err);
+    }
+}
+
+void BatchReadClient::Node::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                  const SessionHandle & sessionHandle)
+{
+    Node * const _this = static_cast<Node *>(context);
+    VerifyOrDie(_this != nullptr);
+
+    _this->SendRequest(sessionHandle);
+}
+
+void BatchReadClient::Node::HandleDeviceConnectionFailure(void * context,
+                                                          const OperationalSessionSetup::ConnectionFailureInfo & failureInfo)
+{
+    Node * const _this = static_cast<Node *>(context);
+    VerifyOrDie(_this != nullptr);
+
+    ChipLogError(DataManagement, "Batch failed to establish CASE with " ChipLogFormatScopedNodeId ": %" CHIP_ERROR_FORMAT,
+                 ChipLogValueScopedNodeId(_this->mPeer), failureInfo.error.Format());
+    _this->mBatch.OnNodeStatus(*_this, failureInfo.error);
+}
+
+void BatchReadClient::Node::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                            const StatusIB & aStatus)
+{
+    mBatch.mCallback.OnAttributeData(mPeer, aPath, apData, aStatus);
+}
+
+void BatchReadClient::Node::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus)
+{
+    mBatch.mCallback.OnEventData(mPeer, aEventHeader, apData, apStatus);
+}
+
+void BatchReadClient::Node::OnSubscriptionEstablished(SubscriptionId aSubscriptionId)
+{
+    mBatch.OnNodeStatus(*this, CHIP_NO_ERROR);
+}
+
+CHIP_ERROR BatchReadClient::Node::OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause)
+{
+    // Retrying a subscription that was never established would keep the node from ever settling: only
+    // re-subscribe once the subscription has been up.
+    VerifyOrReturnError(mState == NodeState::kSettled, aTerminationCause);
+    return ReadClient::Callback::OnResubscriptionNeeded(apReadClient, aTerminationCause);
+}
+
+void BatchReadClient::Node::OnError(CHIP_ERROR aError)
+{
+    mStatus = aError;
+}
+
+void BatchReadClient::Node::OnDone(ReadClient * apReadClient)
+{
+    // For a subscription, getting here means it is gone for good.
+    CHIP_ERROR status = mStatus;
+    if (status == CHIP_NO_ERROR && mBatch.mInteractionType == ReadClient::InteractionType::Subscribe)
+    {
+        status = CHIP_ERROR_CONNECTION_ABORTED;
+    }
+
+    mReadClient.reset();
+    mBatch.OnNodeStatus(*this, status);
+}
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
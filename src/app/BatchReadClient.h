@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a client that reads or subscribes to the same paths on many nodes.
+ *
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/OperationalSessionSetup.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+namespace chip {
+namespace app {
+
+class InteractionModelEngine;
+
+/**
+ *  @class BatchReadClient
+ *
+ *  @brief Reads, or subscribes to, one set of paths on a set of nodes.
+ *
+ *         Each node gets its own ReadClient, but all of them share the path lists given to SendRequest, so a node
+ *         only costs a ReadClient and a little bookkeeping.
+ *
+ *         Nodes are started in order, with at most a given number of them in the setup phase (finding or establishing
+ *         a CASE session, then sending the request and receiving the data for a read, or the priming reports for a
+ *         subscription) at any time.  The next node is started as soon as one of them settles, which keeps large
+ *         batches from flooding the network, the CASE client pool or the peers' read handler pools.
+ *
+ *         An existing CASE session to a node is reused; otherwise one is established through the CASESessionManager
+ *         of the InteractionModelEngine.  Subscriptions are set up to automatically re-subscribe once established.
+ *
+ *         Like a ReadClient, a BatchReadClient is owned by the application: the InteractionModelEngine does not track it.
+ *
+ *         All the results are delivered through a single BatchReadClient::Callback, along with the node they came from.
+ */
+class BatchReadClient
+{
+public:
+    static constexpr size_t kDefaultMaxConcurrentSetups = 4;
+
+    class Callback
+    {
+    public:
+        virtual ~Callback() = default;
+
+        /**
+         * Same as ReadClient::Callback::OnAttributeData, for data from the node aNode.
+         */
+        virtual void OnAttributeData(const ScopedNodeId & aNode, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                     const StatusIB & aStatus)
+        {}
+
+        /**
+         * Same as ReadClient::Callback::OnEventData, for data from the node aNode.
+         */
+        virtual void OnEventData(const ScopedNodeId & aNode, const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                 const StatusIB * apStatus)
+        {}
+
+        /**
+         * Called when the status of the interaction with aNode changes:
+         *
+         *      - With CHIP_NO_ERROR when a read has completed, or a subscription has been established.
+         *      - With an error when setting up the interaction failed, or when an established subscription
+         *        terminated for good (i.e. re-subscription was given up on).
+         *
+         * The first call for each node counts towards the completion of the batch.
+         */
+        virtual void OnNodeStatus(const ScopedNodeId & aNode, CHIP_ERROR aError) {}
+
+        /**
+         * Called once every node has had a first OnNodeStatus call.  Established subscriptions stay up
+         * until the BatchReadClient is destroyed.
+         *
+         * This is called from the event loop, after the call that settled the last node has returned,
+         * so the BatchReadClient may be destroyed from within this callback.  It must not be destroyed
+         * from the other ones, which run from within the ReadClient and session setup callbacks.
+         */
+        virtual void OnBatchDone(BatchReadClient & aBatch) = 0;
+    };
+
+    /**
+     *  The callback has to outlive this BatchReadClient object.
+     *
+     *  @param[in]    apImEngine       A valid pointer to the IM engine.
+     *  @param[in]    apExchangeMgr    A valid pointer to the ExchangeManager.
+     *  @param[in]    aCallback        Callback set by application.
+     *  @param[in]    aInteractionType Type of interaction (read or subscribe)
+     */
+    BatchReadClient(InteractionModelEngine * apImEngine, Messaging::ExchangeManager * apExchangeMgr, Callback & aCallback,
+                    ReadClient::InteractionType aInteractionType);
+
+    /**
+     * Cancels any pending session establishment and tears down all the interactions, without calling
+     * the callback (including a pending OnBatchDone).
+     */
+    ~BatchReadClient();
+
+    BatchReadClient(const BatchReadClient &)             = delete;
+    BatchReadClient & operator=(const BatchReadClient &) = delete;
+
+    /**
+     *  Start the interaction with every node of aNodes.
+     *
+     *  The path and data version filter lists of aReadPrepareParams are not copied: they must stay valid
+     *  until this object is destroyed.  The session of aReadPrepareParams is ignored.  aNodes is copied.
+     *
+     *  @param[in]    aNodes               The nodes to read from or subscribe to.
+     *  @param[in]    aReadPrepareParams   The parameters of the interaction with each node.
+     *  @param[in]    aMaxConcurrentSetups The maximum number of nodes in the setup phase at any time.
+     *
+     *  @retval #CHIP_ERROR_INCORRECT_STATE if a request was already sent.
+     *  @retval #CHIP_ERROR_INVALID_ARGUMENT if there are no nodes, a node appears more than once, there are no paths,
+     *                                       or aMaxConcurrentSetups is 0.
+     *  @retval #CHIP_ERROR_NO_MEMORY if there is no memory for the bookkeeping of the nodes.
+     *  @retval #CHIP_NO_ERROR On success.  Failures to reach individual nodes are reported through OnNodeStatus.
+     */
+    CHIP_ERROR SendRequest(Span<const ScopedNodeId> aNodes, const ReadPrepareParams & aReadPrepareParams,
+                           size_t aMaxConcurrentSetups = kDefaultMaxConcurrentSetups);
+
+    size_t GetNodeCount() const { return mNodeCount; }
+    size_t GetSettledNodeCount() const { return mSettledCount; }
+    size_t GetFailedNodeCount() const { return mFailedCount; }
+
+    /**
+     * Returns the status of the interaction with aNode, as last reported through OnNodeStatus.
+     *
+     * @retval #CHIP_ERROR_KEY_NOT_FOUND if aNode is not part of the batch.
+     * @retval #CHIP_ERROR_BUSY if the node has not settled yet.
+     */
+    CHIP_ERROR GetNodeStatus(const ScopedNodeId & aNode) const;
+
+private:
+    enum class NodeState : uint8_t
+    {
+        kPending,    ///< Not started yet.
+        kConnecting, ///< Waiting for a CASE session.
+        kRequesting, ///< Waiting for the read to complete or the subscription to be established.
+        kSettled,    ///< Read complete, subscription established, or failed.
+    };
+
+    class Node : public ReadClient::Callback
+    {
+    public:
+        Node(BatchReadClient & aBatch, const ScopedNodeId & aPeer);
+
+        void Connect();
+        void Cancel();
+
+        // ReadClient::Callback overrides
+        void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
+        void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override;
+        void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override;
+        CHIP_ERROR OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override;
+        void OnError(CHIP_ERROR aError) override;
+        void OnDone(ReadClient * apReadClient) override;
+        void OnDeallocatePaths(ReadPrepareParams && aReadPrepareParams) override {}
+
+        static void HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                          const SessionHandle & sessionHandle);
+        static void HandleDeviceConnectionFailure(void * context,
+                                                  const OperationalSessionSetup::ConnectionFailureInfo & failureInfo);
+
+        void SendRequest(const SessionHandle & aSessionHandle);
+
+        BatchReadClient & mBatch;
+        Node * mpNext = nullptr;
+        const ScopedNodeId mPeer;
+        NodeState mState   = NodeState::kPending;
+        CHIP_ERROR mStatus = CHIP_NO_ERROR;
+        Platform::UniquePtr<ReadClient> mReadClient;
+        chip::Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
+        chip::Callback::Callback<OperationalSessionSetup::OnSetupFailure> mOnConnectionFailureCallback;
+    };
+
+    void OnNodeStatus(Node & aNode, CHIP_ERROR aError);
+    void StartPendingNodes();
+    void ReleaseNodes();
+
+    static void HandleBatchDone(System::Layer * aSystemLayer, void * aAppState);
+
+    InteractionModelEngine * mpImEngine;
+    Messaging::ExchangeManager * mpExchangeMgr;
+    Callback & mCallback;
+    ReadClient::InteractionType mInteractionType;
+
+    ReadPrepareParams mReadPrepareParams;
+    Node * mpNodes        = nullptr;
+    Node * mpNextPending  = nullptr;
+    size_t mNodeCount     = 0;
+    size_t mSettledCount  = 0;
+    size_t mFailedCount   = 0;
+    size_t mInFlight      = 0;
+    size_t mMaxInFlight   = 0;
+    bool mStartingNodes   = false;
+    bool mBatchDoneQueued = false;
+};
+
+} // namespace app
+} // namespace chip
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
@@ -103,6 +103,16 @@ public:
      */
     virtual void ResponseDropped() = 0;
 
+    /**
+     * @brief Whether InvokeResponseMessages can be sent while commands of the request are still
+     * being processed asynchronously.
+     *
+     * When this returns true, CommandHandler hands the responses that are ready over to
+     * AddInvokeResponseToSend as a chunk of their own whenever asynchronous work completes, instead
+     * of holding them until the slowest command of the request is done.
+     */
+    virtual bool CanSendInvokeResponsesEarly() { return false; }
+
     /**
      * @brief Gets the maximum size of a packet buffer to encode a Command
      * Response message. This size depends on the underlying session used
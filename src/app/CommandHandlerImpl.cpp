@@ -345,6 +345,7 @@ void CommandHandlerImpl::DecrementHoldOff(Handle * apHandle)
 
     if (mPendingWork != 0)
     {
+        SendReadyResponsesEarly();
         return;
     }
 
@@ -677,6 +678,7 @@ CHIP_ERROR CommandHandlerImpl::FinishCommand(bool aStartDataStruct)
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
     MoveToState(State::AddedCommand);
+    mNumResponsesAdded++;
     return CHIP_NO_ERROR;
 }
 
@@ -722,6 +724,7 @@ CHIP_ERROR CommandHandlerImpl::FinishStatus()
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB());
     MoveToState(State::AddedCommand);
+    mNumResponsesAdded++;
     return CHIP_NO_ERROR;
 }
 
@@ -785,6 +788,22 @@ CHIP_ERROR CommandHandlerImpl::FinalizeInvokeResponseMessageAndPrepareNext()
     return err;
 }
 
+void CommandHandlerImpl::SendReadyResponsesEarly()
+{
+    // Responses can only be split across messages once the whole request has been processed, if it allows chunking, and
+    // if there is something to send now and more to send later: every command gets exactly one response, so as long as
+    // fewer responses than commands were added, the last message is not going to be empty.
+    VerifyOrReturn(mGoneAsync && mReserveSpaceForMoreChunkMessages && mState == State::AddedCommand);
+    VerifyOrReturn(mNumResponsesAdded < GetCommandPathRegistry().Count());
+    VerifyOrReturn(mpResponder != nullptr && mpResponder->CanSendInvokeResponsesEarly());
+
+    CHIP_ERROR err = FinalizeInvokeResponseMessageAndPrepareNext();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send ready command responses early: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
 CHIP_ERROR CommandHandlerImpl::FinalizeInvokeResponseMessage(bool aHasMoreChunks)
 {
     System::PacketBufferHandle packet;
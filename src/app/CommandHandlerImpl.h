@@ -175,6 +175,11 @@ public:
      */
     CHIP_ERROR ValidateInvokeRequestMessageAndBuildRegistry(InvokeRequestMessage::Parser & invokeRequestMessage);
 
+    /**
+     * Whether some CommandHandler::Handle still holds off the completion of this CommandHandler.
+     */
+    bool HasPendingWork() const { return mPendingWork != 0; }
+
     /**
      * This adds a new CommandDataIB element into InvokeResponses for the associated
      * aRequestCommandPath. This adds up until the `CommandFields` element within
@@ -390,6 +395,13 @@ private:
 
     CHIP_ERROR FinalizeInvokeResponseMessage(bool aHasMoreChunks);
 
+    /**
+     * Called when asynchronous work completes while other commands are still pending: if the responder
+     * allows it, hands the responses added so far over as a chunk, so that they are not held up by
+     * the remaining commands.
+     */
+    void SendReadyResponsesEarly();
+
     Protocols::InteractionModel::Status ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke);
 
     /**
@@ -457,6 +469,7 @@ private:
     InvokeResponseMessage::Builder mInvokeResponseBuilder;
     TLV::TLVType mDataElementContainerType = TLV::kTLVType_NotSpecified;
     size_t mPendingWork                    = 0;
+    size_t mNumResponsesAdded              = 0;
     /* List to store all currently-outstanding Handles for this Command Handler.*/
     IntrusiveList<Handle> mpHandleList;
 
@@ -227,6 +227,8 @@ protected:
     Optional<EndpointId> GetEndpointId() { return mEndpointId; }
 
 private:
+    friend class CommandHandlerInterfaceRegistry; // indexes handlers by endpoint and cluster
+
     Optional<EndpointId> mEndpointId;
     ClusterId mClusterId;
     CommandHandlerInterface * mNext = nullptr;
@@ -43,6 +43,7 @@ void CommandHandlerInterfaceRegistry::UnregisterAllHandlers()
     }
 
     mCommandHandlerList = nullptr;
+    mIndex.Invalidate();
 }
 
 CHIP_ERROR CommandHandlerInterfaceRegistry::RegisterCommandHandler(CommandHandlerInterface * handler)
@@ -60,12 +61,14 @@ CHIP_ERROR CommandHandlerInterfaceRegistry::RegisterCommandHandler(CommandHandle
 
     handler->SetNext(mCommandHandlerList);
     mCommandHandlerList = handler;
+    mIndex.Invalidate();
 
     return CHIP_NO_ERROR;
 }
 
 void CommandHandlerInterfaceRegistry::UnregisterAllCommandHandlersForEndpoint(EndpointId endpointId)
 {
+    mIndex.Invalidate();
     CommandHandlerInterface * prev = nullptr;
 
     for (auto * cur = mCommandHandlerList; cur;)
@@ -114,6 +117,7 @@ CHIP_ERROR CommandHandlerInterfaceRegistry::UnregisterCommandHandler(CommandHand
             }
 
             cur->SetNext(nullptr);
+            mIndex.Invalidate();
 
             return CHIP_NO_ERROR;
         }
@@ -126,6 +130,17 @@ CHIP_ERROR CommandHandlerInterfaceRegistry::UnregisterCommandHandler(CommandHand
 
 CommandHandlerInterface * CommandHandlerInterfaceRegistry::GetCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
+    if (mIndex.IsAvailable(
+            mCommandHandlerList, [](CommandHandlerInterface * entry) { return entry->GetNext(); },
+            [](CommandHandlerInterface * entry, Optional<EndpointId> & entryEndpointId, ClusterId & entryClusterId) {
+                entryEndpointId = entry->mEndpointId;
+                entryClusterId  = entry->mClusterId;
+            }))
+    {
+        return mIndex.Find(endpointId, clusterId);
+    }
+
+    // No usable index (indexing disabled or too many handlers): search the list
     for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
     {
         if (cur->Matches(endpointId, clusterId))
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <app/CommandHandlerInterface.h>
+#include <app/InterfaceRegistryIndex.h>
 
 namespace chip {
 namespace app {
@@ -54,6 +55,7 @@ public:
 
 private:
     CommandHandlerInterface * mCommandHandlerList = nullptr;
+    InterfaceRegistryIndex<CommandHandlerInterface> mIndex;
 };
 
 } // namespace app
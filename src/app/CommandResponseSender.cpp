@@ -38,13 +38,21 @@ CHIP_ERROR CommandResponseSender::OnMessageReceived(Messaging::ExchangeContext *
         err = statusError;
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::InvalidAction));
 
+        if (mChunks.IsNull() && mCommandHandler.HasPendingWork())
+        {
+            // Responses are being sent early, and the next ones are not ready yet.
+            MoveToState(State::ReadyForInvokeResponses);
+            mExchangeCtx->WillSendMessage();
+            return CHIP_NO_ERROR;
+        }
+
         err = SendCommandResponse();
         // If SendCommandResponse() fails, we must close the exchange. We signal the failure to the
         // requester with a StatusResponse ('Failure'). Since we're in the middle of processing an
         // incoming message, we close the exchange by indicating that we don't expect a further response.
         VerifyOrExit(err == CHIP_NO_ERROR, failureStatusToSend.SetValue(Status::Failure));
 
-        bool moreToSend = !mChunks.IsNull();
+        bool moreToSend = !mChunks.IsNull() || mCommandHandler.HasPendingWork();
         if (!moreToSend)
         {
             // We are sending the final message and do not anticipate any further responses. We are
@@ -122,9 +130,41 @@ void CommandResponseSender::OnDone(CommandHandlerImpl & apCommandObj)
         Close();
         return;
     }
+    if (mState == State::AwaitingStatusResponse)
+    {
+        // Responses are being sent early: the remaining ones are sent once the requester
+        // acknowledges the last chunk.
+        return;
+    }
     StartSendingCommandResponses();
 }
 
+void CommandResponseSender::AddInvokeResponseToSend(System::PacketBufferHandle && aPacket)
+{
+    if (mState == State::ErrorSentDelayCloseUntilOnDone)
+    {
+        // The requester is not expecting any more InvokeResponses.
+        return;
+    }
+    VerifyOrDie(mState == State::ReadyForInvokeResponses ||
+                (CanSendInvokeResponsesEarly() && mState == State::AwaitingStatusResponse));
+    mChunks.AddToEnd(std::move(aPacket));
+
+    // Unless responses are sent early, everything is sent once the CommandHandler is done.
+    VerifyOrReturn(mState == State::ReadyForInvokeResponses && CanSendInvokeResponsesEarly() && mCommandHandler.HasPendingWork());
+
+    CHIP_ERROR err = SendCommandResponse();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send InvokeResponseMessage early: %" CHIP_ERROR_FORMAT, err.Format());
+        SendStatusResponse(Status::Failure);
+        Close();
+        return;
+    }
+    MoveToState(State::AwaitingStatusResponse);
+    mExchangeCtx->SetDelegate(this);
+}
+
 void CommandResponseSender::DispatchCommand(CommandHandlerImpl & apCommandObj, const ConcreteCommandPath & aCommandPath,
                                             TLV::TLVReader & apPayload)
 {
@@ -151,7 +191,7 @@ CHIP_ERROR CommandResponseSender::SendCommandResponse()
     System::PacketBufferHandle commandResponsePayload = mChunks.PopHead();
 
     Messaging::SendFlags sendFlag = Messaging::SendMessageFlags::kNone;
-    if (HasMoreToSend())
+    if (WillHaveMoreToSend())
     {
         sendFlag = Messaging::SendMessageFlags::kExpectResponse;
         mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
@@ -196,6 +236,14 @@ void CommandResponseSender::MoveToState(const State aTargetState)
 
 void CommandResponseSender::Close()
 {
+    if (mCommandHandler.HasPendingWork())
+    {
+        // Only happens when responses are sent early: this object has to outlive the CommandHandler,
+        // but whatever it adds from now on can be dropped.
+        mExchangeCtx.Release();
+        MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        return;
+    }
     MoveToState(State::AllInvokeResponsesSent);
     mpCallback->OnDone(*this);
 }
@@ -223,7 +271,11 @@ void CommandResponseSender::OnInvokeCommandRequest(Messaging::ExchangeContext *
         // the CommandHandler. Therefore, we cannot safely call Close() here, even though we have
         // finished sending data. Closing must be deferred until the CommandHandler::OnDone callback.
         MoveToState(State::ErrorSentDelayCloseUntilOnDone);
+        return;
     }
+
+    // From now on, the responses to the request are not going to be replaced by an error StatusResponse.
+    mInvokeRequestAccepted = true;
 }
 
 size_t CommandResponseSender::GetCommandResponseMaxBufferSize()
@@ -54,6 +54,20 @@ public:
         mpCallback(apCallback), mpCommandHandlerCallback(apDispatchCallback), mCommandHandler(this), mExchangeCtx(*this)
     {}
 
+    /*
+     * Constructor to override the number of supported paths per invoke.
+     *
+     * The callbacks and any pointers passed via TestOnlyOverrides must outlive this
+     * CommandResponseSender object.
+     *
+     * For testing purposes.
+     */
+    CommandResponseSender(Callback * apCallback, CommandHandlerImpl::Callback * apDispatchCallback,
+                          CommandHandlerImpl::TestOnlyOverrides & aTestOverride) :
+        mpCallback(apCallback), mpCommandHandlerCallback(apDispatchCallback), mCommandHandler(aTestOverride, this),
+        mExchangeCtx(*this)
+    {}
+
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
 
@@ -116,14 +130,21 @@ public:
         msgContext->FlushAcks();
     }
 
-    void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override
-    {
-        VerifyOrDie(mState == State::ReadyForInvokeResponses);
-        mChunks.AddToEnd(std::move(aPacket));
-    }
+    void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override;
 
     void ResponseDropped() override { mReportResponseDropped = true; }
 
+    bool CanSendInvokeResponsesEarly() override { return mSendResponsesEarly && mInvokeRequestAccepted; }
+
+    /**
+     * Allows the responses to a batch invoke to be sent in chunks as they become ready, instead of all
+     * together once every command of the batch is done.  This keeps fast commands from waiting on
+     * asynchronous ones (e.g. commands to bridged devices), at the cost of more messages.
+     *
+     * Must be called before OnInvokeCommandRequest.
+     */
+    void SetSendResponsesEarly(bool aSendResponsesEarly) { mSendResponsesEarly = aSendResponsesEarly; }
+
     size_t GetCommandResponseMaxBufferSize() override;
 
     /*
@@ -155,6 +176,8 @@ public:
 #endif // CHIP_WITH_NLFAULTINJECTION
 
 private:
+    friend class TestCommandInteraction;
+
     enum class State : uint8_t
     {
         ReadyForInvokeResponses,       ///< Accepting InvokeResponses to send back to requester.
@@ -178,6 +201,8 @@ private:
 
     CHIP_ERROR SendCommandResponse();
     bool HasMoreToSend() { return !mChunks.IsNull() || mReportResponseDropped; }
+    // Responses that are sent while the CommandHandler is still working are always followed by more.
+    bool WillHaveMoreToSend() { return HasMoreToSend() || mCommandHandler.HasPendingWork(); }
     void Close();
 
     // A list of InvokeResponseMessages to be sent out by CommandResponseSender.
@@ -190,6 +215,8 @@ private:
     State mState = State::ReadyForInvokeResponses;
 
     bool mReportResponseDropped = false;
+    bool mSendResponsesEarly    = false;
+    bool mInvokeRequestAccepted = false;
 };
 
 } // namespace app
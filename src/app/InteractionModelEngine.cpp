@@ -49,6 +49,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/FibonacciUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/macros.h>
 
 namespace chip {
 namespace app {
@@ -507,6 +508,7 @@ void InteractionModelEngine::OnDone(ReadHandler & apReadObj)
     mReportingEngine.ResetReadHandlerTracker(&apReadObj);
 
     mReadHandlers.ReleaseObject(&apReadObj);
+    MATTER_TRACE_COUNTER_VALUE("ActiveReadHandlers", mReadHandlers.Allocated());
     TryToResumeSubscriptions();
 }
 
@@ -537,6 +539,7 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
         ChipLogProgress(InteractionModel, "no resource for Invoke interaction");
         return Status::Busy;
     }
+    commandResponder->SetSendResponsesEarly(mSendInvokeResponsesEarly);
     CHIP_FAULT_INJECT(FaultInjection::kFault_IMInvoke_SeparateResponses,
                       commandResponder->TestOnlyInvokeCommandRequestWithFaultsInjected(
                           apExchangeContext, std::move(aPayload), aIsTimedInvoke,
@@ -854,6 +857,7 @@ Protocols::InteractionModel::Status InteractionModelEngine::OnReadInitialRequest
                         aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
         return Status::ResourceExhausted;
     }
+    MATTER_TRACE_COUNTER_VALUE("ActiveReadHandlers", mReadHandlers.Allocated());
 
     handler->OnInitialRequest(std::move(aPayload));
 
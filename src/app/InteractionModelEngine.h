@@ -417,6 +417,14 @@ public:
     // Returns the old data model provider value.
     DataModel::Provider * SetDataModelProvider(DataModel::Provider * model);
 
+    /**
+     * Sets whether the responses to batch invokes are sent in chunks as soon as they are ready, instead of
+     * all together once every command of the batch is done (see CommandResponseSender::SetSendResponsesEarly).
+     *
+     * Only applies to invokes received after the call.
+     */
+    void SetSendInvokeResponsesEarly(bool sendEarly) { mSendInvokeResponsesEarly = sendEarly; }
+
 private:
     /* DataModel::ActionContext implementation */
     Messaging::ExchangeContext * CurrentExchange() override { return mCurrentExchange; }
@@ -676,6 +684,8 @@ private:
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
 
+    bool mSendInvokeResponsesEarly = false;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     int mReadHandlerCapacityForSubscriptionsOverride = -1;
     int mPathPoolCapacityForSubscriptionsOverride    = -1;
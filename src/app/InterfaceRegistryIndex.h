@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/// Hash index of (endpoint, cluster) to registered interface, used by the registries of
+/// intrusive lists of interfaces (AttributeAccessInterface, CommandHandlerInterface) so that
+/// lookups do not have to walk the whole list.
+///
+/// Registries call `Invalidate` whenever their list changes; the index is rebuilt from the list
+/// by the next lookup, so a burst of registrations only rebuilds it once. Interfaces registered
+/// for all endpoints are indexed under kInvalidEndpointId and only looked up when there is no
+/// interface for the specific endpoint.
+///
+/// The index holds up to kSlotCount / 2 interfaces. With more registered interfaces,
+/// `IsAvailable` returns false and callers are expected to walk their list instead.
+///
+/// Like the registries themselves, this is not thread safe: it is meant to be used with the
+/// Matter stack lock held.
+template <typename T, size_t kSlotCount = CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS>
+class InterfaceRegistryIndex
+{
+public:
+    static_assert((kSlotCount & (kSlotCount - 1)) == 0, "Slot count must be a power of 2");
+
+    void Invalidate() { mState = State::kStale; }
+
+    /// Makes sure the index reflects the list starting at `head`.
+    ///
+    /// `getNext(T *)` returns the next list element and `getKey(T *, Optional<EndpointId> &, ClusterId &)`
+    /// returns the endpoint (none for all endpoints) and cluster of an element.
+    template <typename GetNext, typename GetKey>
+    bool IsAvailable(T * head, GetNext getNext, GetKey getKey)
+    {
+        if (mState == State::kStale)
+        {
+            Rebuild(head, getNext, getKey);
+        }
+        return mState == State::kValid;
+    }
+
+    /// Returns the interface for the given endpoint and cluster, or nullptr. The index must be available.
+    T * Find(EndpointId endpointId, ClusterId clusterId) const
+    {
+        T * found = FindExact(endpointId, clusterId);
+        return (found != nullptr) ? found : FindExact(kInvalidEndpointId, clusterId);
+    }
+
+private:
+    enum class State : uint8_t
+    {
+        kStale,
+        kValid,
+        kUnavailable, // too many interfaces, until the list changes
+    };
+
+    struct Slot
+    {
+        EndpointId endpointId;
+        ClusterId clusterId;
+        T * value; // nullptr for unused slots
+    };
+
+    Slot mSlots[kSlotCount];
+    State mState = State::kStale;
+
+    static size_t HomeSlot(EndpointId endpointId, ClusterId clusterId)
+    {
+        // Cluster ids of a vendor share their high bits and endpoint ids are small, so mix both.
+        uint32_t hash = (clusterId ^ (clusterId >> 16) ^ (static_cast<uint32_t>(endpointId) << 8)) * 0x9E3779B1u;
+        return static_cast<size_t>(hash >> 8) & (kSlotCount - 1);
+    }
+
+    T * FindExact(EndpointId endpointId, ClusterId clusterId) const
+    {
+        for (size_t index = HomeSlot(endpointId, clusterId);; index = (index + 1) & (kSlotCount - 1))
+        {
+            const Slot & slot = mSlots[index];
+            if (slot.value == nullptr)
+            {
+                return nullptr;
+            }
+            if ((slot.endpointId == endpointId) && (slot.clusterId == clusterId))
+            {
+                return slot.value;
+            }
+        }
+    }
+
+    template <typename GetNext, typename GetKey>
+    void Rebuild(T * head, GetNext getNext, GetKey getKey)
+    {
+        // Keep the load factor at or below 1/2 so that probe sequences stay short
+        size_t count = 0;
+        for (T * cur = head; cur != nullptr; cur = getNext(cur))
+        {
+            if (++count > kSlotCount / 2)
+            {
+                mState = State::kUnavailable;
+                return;
+            }
+        }
+
+        for (auto & slot : mSlots)
+        {
+            slot.value = nullptr;
+        }
+
+        for (T * cur = head; cur != nullptr; cur = getNext(cur))
+        {
+            Optional<EndpointId> endpointId;
+            ClusterId clusterId;
+            getKey(cur, endpointId, clusterId);
+
+            Slot slot{ endpointId.ValueOr(kInvalidEndpointId), clusterId, cur };
+            size_t index = HomeSlot(slot.endpointId, slot.clusterId);
+            while (mSlots[index].value != nullptr)
+            {
+                index = (index + 1) & (kSlotCount - 1);
+            }
+            mSlots[index] = slot;
+        }
+
+        mState = State::kValid;
+    }
+};
+
+/// Registries without an index (CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS set to 0) always walk their list.
+template <typename T>
+class InterfaceRegistryIndex<T, 0>
+{
+public:
+    void Invalidate() {}
+
+    template <typename GetNext, typename GetKey>
+    bool IsAvailable(T * head, GetNext getNext, GetKey getKey)
+    {
+        return false;
+    }
+
+    T * Find(EndpointId endpointId, ClusterId clusterId) const { return nullptr; }
+};
+
+} // namespace app
+} // namespace chip
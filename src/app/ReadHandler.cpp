@@ -861,8 +861,9 @@ void ReadHandler::ResetPathIterator()
 void ReadHandler::AttributePathIsDirty(const AttributePathParams & aAttributeChanged)
 {
     ConcreteAttributePath path;
+    reporting::Engine & reportingEngine = mManagementCallback.GetInteractionModelEngine()->GetReportingEngine();
 
-    mDirtyGeneration = mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().GetDirtySetGeneration();
+    mDirtyGeneration = reportingEngine.GetDirtySetGeneration();
 
     // We won't reset the path iterator for every AttributePathIsDirty call to reduce the number of full data reports.
     // The iterator will be reset after finishing each report session.
@@ -887,10 +888,23 @@ void ReadHandler::AttributePathIsDirty(const AttributePathParams & aAttributeCha
         mAttributeEncoderState.Reset();
     }
 
+    if (reportingEngine.IsBatchingDirtyPaths())
+    {
+        mFlags.Set(ReadHandlerFlags::BecameReportableDeferred);
+        return;
+    }
+
     // ReportScheduler will take care of verifying the reportability of the handler and schedule the run
     mObserver->OnBecameReportable(this);
 }
 
+void ReadHandler::NotifyDeferredBecameReportable()
+{
+    VerifyOrReturn(mFlags.Has(ReadHandlerFlags::BecameReportableDeferred));
+    mFlags.Clear(ReadHandlerFlags::BecameReportableDeferred);
+    mObserver->OnBecameReportable(this);
+}
+
 Transport::SecureSession * ReadHandler::GetSession() const
 {
     if (!mSessionHandle)
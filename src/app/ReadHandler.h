@@ -325,6 +325,10 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // Set when an attribute path became dirty while the reporting engine was batching dirty paths; the observer is notified
+        // once when the batch ends instead of once per path.
+        BecameReportableDeferred = (1 << 6),
     };
 
     /**
@@ -519,6 +523,10 @@ private:
     /// @param aFlag Flag to clear
     void ClearStateFlag(ReadHandlerFlags aFlag);
 
+    /// @brief Notifies the observer that this handler became reportable if that notification was held back while the reporting
+    /// engine was batching dirty paths.
+    void NotifyDeferredBecameReportable();
+
     AttributePathExpandIterator mAttributePathExpandIterator;
 
     // The current generation of the reporting engine dirty set the last time we were notified that a path we're interested in was
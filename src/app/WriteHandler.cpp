@@ -654,6 +654,8 @@ Status WriteHandler::ProcessWriteRequest(System::PacketBufferHandle && aPayload,
 
     AttributeDataIBsParser.GetReader(&AttributeDataIBsReader);
 
+    // Let the reporting engine schedule reports once for the whole chunk instead of once per written attribute.
+    InteractionModelEngine::GetInstance()->GetReportingEngine().BeginDirtyPathBatch();
     if (mExchangeCtx->IsGroupExchangeContext())
     {
         err = ProcessGroupAttributeDataIBs(AttributeDataIBsReader);
@@ -662,6 +664,7 @@ Status WriteHandler::ProcessWriteRequest(System::PacketBufferHandle && aPayload,
     {
         err = ProcessAttributeDataIBs(AttributeDataIBsReader);
     }
+    InteractionModelEngine::GetInstance()->GetReportingEngine().EndDirtyPathBatch();
     SuccessOrExit(err);
     SuccessOrExit(err = writeRequestParser.ExitContainer());
 
@@ -159,6 +159,26 @@ struct DeviceTypeEntry
     }
 };
 
+/// Caller-owned position of one metadata iteration (over endpoints, over the server clusters
+/// of an endpoint or over the attributes of a cluster).
+///
+/// `Next*(before)` calls have to locate `before` again on every call. Providers may cache where
+/// the last returned element was, however such a cache is shared by all iterations and is lost
+/// as soon as two of them interleave (e.g. several ReadHandlers expanding wildcard paths).
+/// A cursor keeps that position with the iteration instead.
+///
+/// The content of a cursor is provider-specific. Callers default-construct it, pass it to the
+/// `First*WithCursor` call that starts an iteration and then to every `Next*WithCursor` call of
+/// that same iteration. Providers validate a cursor before relying on it, so a stale cursor
+/// (e.g. after an endpoint was removed) only costs a search.
+struct MetadataCursor
+{
+    const void * container = nullptr;            // e.g. the provider structure that `index` refers to
+    EndpointId endpoint    = kInvalidEndpointId; // the endpoint `container` was found for
+    unsigned index         = 0;
+    unsigned generation    = 0;
+};
+
 /// Provides metadata information for a data model
 ///
 /// The data model can be viewed as a tree of endpoint/cluster/(attribute+commands+events)
@@ -212,6 +232,29 @@ public:
     virtual AttributeEntry NextAttribute(const ConcreteAttributePath & before)                = 0;
     virtual std::optional<AttributeInfo> GetAttributeInfo(const ConcreteAttributePath & path) = 0;
 
+    // Cursor-based variants of the endpoint, server cluster and attribute iterations above. They
+    // return the same entries, but providers may use the cursor to avoid searching for `before`.
+    //
+    // The default implementations ignore the cursor.
+    virtual EndpointEntry FirstEndpointWithCursor(MetadataCursor & cursor) { return FirstEndpoint(); }
+    virtual EndpointEntry NextEndpointWithCursor(EndpointId before, MetadataCursor & cursor) { return NextEndpoint(before); }
+    virtual ClusterEntry FirstServerClusterWithCursor(EndpointId endpoint, MetadataCursor & cursor)
+    {
+        return FirstServerCluster(endpoint);
+    }
+    virtual ClusterEntry NextServerClusterWithCursor(const ConcreteClusterPath & before, MetadataCursor & cursor)
+    {
+        return NextServerCluster(before);
+    }
+    virtual AttributeEntry FirstAttributeWithCursor(const ConcreteClusterPath & cluster, MetadataCursor & cursor)
+    {
+        return FirstAttribute(cluster);
+    }
+    virtual AttributeEntry NextAttributeWithCursor(const ConcreteAttributePath & before, MetadataCursor & cursor)
+    {
+        return NextAttribute(before);
+    }
+
     // Command iteration and accessors provide cluster-level access over commands
     virtual CommandEntry FirstAcceptedCommand(const ConcreteClusterPath & cluster)              = 0;
     virtual CommandEntry NextAcceptedCommand(const ConcreteCommandPath & before)                = 0;
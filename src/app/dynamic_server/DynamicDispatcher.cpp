@@ -263,6 +263,12 @@ unsigned emberAfMetadataStructureGeneration()
     return 0;
 }
 
+unsigned emberAfUnversionedAttributeChangeGeneration()
+{
+    // No attribute values are kept in ember storage.
+    return 0;
+}
+
 Protocols::InteractionModel::Status emberAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWriteDataInput & input)
 {
     return Protocols::InteractionModel::Status::UnsupportedAttribute;
@@ -35,6 +35,7 @@
 #include <lib/support/CodeUtils.h>
 #include <optional>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/macros.h>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
 #include <app/icd/server/ICDNotifier.h> // nogncheck
@@ -236,8 +237,9 @@ void Engine::Shutdown()
     // Flush out the event buffer synchronously
     ScheduleUrgentEventDeliverySync();
 
-    mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mNumReportsInFlight  = 0;
+    mCurReadHandlerIdx   = 0;
+    mDirtyPathBatchDepth = 0;
     mGlobalDirtySet.ReleaseAll();
 }
 
@@ -272,6 +274,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
 {
+    MATTER_TRACE_SCOPE("BuildSingleReportDataAttributeReportIBs", "ReportingEngine");
+
     CHIP_ERROR err            = CHIP_NO_ERROR;
     bool attributeDataWritten = false;
     bool hasMoreChunks        = true;
@@ -559,6 +563,8 @@ CHIP_ERROR Engine::CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool &
 CHIP_ERROR Engine::BuildSingleReportDataEventReports(ReportDataMessage::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
                                                      bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData)
 {
+    MATTER_TRACE_SCOPE("BuildSingleReportDataEventReports", "ReportingEngine");
+
     CHIP_ERROR err        = CHIP_NO_ERROR;
     size_t eventCount     = 0;
     bool hasEncodedStatus = false;
@@ -666,6 +672,8 @@ exit:
 
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
+    MATTER_TRACE_SCOPE("BuildAndSendSingleReportData", "ReportingEngine");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
@@ -785,6 +793,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     SuccessOrExit(err);
 
     ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
+    MATTER_TRACE_COUNTER_VALUE("ReportBytesEncoded", reportDataWriter.GetLengthWritten());
     err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
@@ -843,6 +852,8 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+    MATTER_TRACE_SCOPE("Run", "ReportingEngine");
+
     uint32_t numReadHandled = 0;
 
     // We may be deallocating read handlers as we go.  Track how many we had
@@ -901,6 +912,7 @@ void Engine::Run()
 
         mGlobalDirtySet.ReleaseAll();
     }
+    MATTER_TRACE_COUNTER_VALUE("GlobalDirtySetSize", mGlobalDirtySet.Allocated());
 }
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
@@ -1068,10 +1080,22 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
         return CHIP_NO_ERROR;
     }
     ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
+    MATTER_TRACE_COUNTER_VALUE("GlobalDirtySetSize", mGlobalDirtySet.Allocated());
 
     return CHIP_NO_ERROR;
 }
 
+void Engine::EndDirtyPathBatch()
+{
+    VerifyOrDie(mDirtyPathBatchDepth > 0);
+    VerifyOrReturn(--mDirtyPathBatchDepth == 0);
+
+    mpImEngine->mReadHandlers.ForEachActiveObject([](ReadHandler * handler) {
+        handler->NotifyDeferredBecameReportable();
+        return Loop::Continue;
+    });
+}
+
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aHasMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
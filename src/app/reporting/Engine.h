@@ -99,6 +99,16 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Starts batching dirty paths: until the matching EndDirtyPathBatch() call, SetDirty still records the paths and updates the
+     * ReadHandlers interested in them, but the report scheduler is only told about each affected ReadHandler once, when the
+     * batch ends, instead of once per dirty path.  This is meant for requests that change many attributes at once, like a write
+     * request.  Batches may be nested; only the outermost EndDirtyPathBatch() notifies the report scheduler.
+     */
+    void BeginDirtyPathBatch() { mDirtyPathBatchDepth++; }
+    void EndDirtyPathBatch();
+    bool IsBatchingDirtyPaths() const { return mDirtyPathBatchDepth > 0; }
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -247,6 +257,11 @@ private:
      */
     uint32_t mNumReportsInFlight = 0;
 
+    /**
+     * Nesting depth of BeginDirtyPathBatch() calls that have not been matched by EndDirtyPathBatch() yet.
+     */
+    uint32_t mDirtyPathBatchDepth = 0;
+
     /**
      *  Current read handler index
      *
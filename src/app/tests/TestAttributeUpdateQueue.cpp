@@ -0,0 +1,197 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributeUpdateQueue.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <atomic>
+#include <string.h>
+#include <vector>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <thread>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr EmberAfAttributeType kUint32Type = 0x23; // ZCL_INT32U_ATTRIBUTE_TYPE
+
+ByteSpan ValueSpan(const uint32_t & value)
+{
+    return ByteSpan(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+}
+
+uint32_t ValueOf(const AttributeUpdateQueue::Update & update)
+{
+    uint32_t value = 0;
+    EXPECT_EQ(update.valueLength, sizeof(value));
+    memcpy(&value, update.value, sizeof(value));
+    return value;
+}
+
+class TestDelegate : public AttributeUpdateQueue::Delegate
+{
+public:
+    CHIP_ERROR ScheduleDrain(AttributeUpdateQueue & queue) override
+    {
+        mScheduleCount++;
+        return mScheduleError;
+    }
+
+    void ApplyUpdate(const AttributeUpdateQueue::Update & update) override { mApplied.push_back(update); }
+
+    std::atomic<size_t> mScheduleCount{ 0 };
+    CHIP_ERROR mScheduleError = CHIP_NO_ERROR;
+    std::vector<AttributeUpdateQueue::Update> mApplied;
+};
+
+TEST(TestAttributeUpdateQueue, TestCoalescing)
+{
+    TestDelegate delegate;
+    AttributeUpdateQueueWithStorage<4> queue(delegate);
+    ASSERT_EQ(queue.Init(), CHIP_NO_ERROR);
+
+    const ConcreteAttributePath pathA(1, 0x0402, 0);
+    const ConcreteAttributePath pathB(2, 0x0402, 0);
+
+    EXPECT_EQ(queue.Enqueue(pathA, kUint32Type, ValueSpan(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(queue.Enqueue(pathB, kUint32Type, ValueSpan(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(queue.Enqueue(pathA, kUint32Type, ValueSpan(3)), CHIP_NO_ERROR);
+
+    // A single drain is scheduled for the whole batch
+    EXPECT_EQ(delegate.mScheduleCount, 1u);
+    EXPECT_EQ(queue.GetCoalescedUpdateCount(), 1u);
+
+    // Latest values, in the order the attributes were first updated
+    EXPECT_EQ(queue.Drain(), 2u);
+    ASSERT_EQ(delegate.mApplied.size(), 2u);
+    EXPECT_EQ(delegate.mApplied[0].path, pathA);
+    EXPECT_EQ(delegate.mApplied[0].type, kUint32Type);
+    EXPECT_EQ(ValueOf(delegate.mApplied[0]), 3u);
+    EXPECT_EQ(delegate.mApplied[1].path, pathB);
+    EXPECT_EQ(ValueOf(delegate.mApplied[1]), 2u);
+    EXPECT_EQ(queue.GetAppliedUpdateCount(), 2u);
+
+    // Nothing left to apply, and the next update schedules a new drain
+    EXPECT_EQ(queue.Drain(), 0u);
+    EXPECT_EQ(queue.Enqueue(pathB, kUint32Type, ValueSpan(4)), CHIP_NO_ERROR);
+    EXPECT_EQ(delegate.mScheduleCount, 2u);
+    EXPECT_EQ(queue.Drain(), 1u);
+    ASSERT_EQ(delegate.mApplied.size(), 3u);
+    EXPECT_EQ(ValueOf(delegate.mApplied[2]), 4u);
+}
+
+TEST(TestAttributeUpdateQueue, TestErrors)
+{
+    TestDelegate delegate;
+    AttributeUpdateQueueWithStorage<2> queue(delegate);
+    ASSERT_EQ(queue.Init(), CHIP_NO_ERROR);
+
+    const uint8_t largeValue[AttributeUpdateQueue::kMaxValueSize + 1] = {};
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(1, 6, 0), 0x41, ByteSpan(largeValue)), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(1, 6, 0), kUint32Type, ValueSpan(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(2, 6, 0), kUint32Type, ValueSpan(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(3, 6, 0), kUint32Type, ValueSpan(1)), CHIP_ERROR_NO_MEMORY);
+
+    // Attributes that are already queued can still be updated when the queue is full
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(2, 6, 0), kUint32Type, ValueSpan(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(queue.Drain(), 2u);
+
+    // When scheduling fails, the update stays queued and the next update tries scheduling again
+    delegate.mScheduleError = CHIP_ERROR_NO_MEMORY;
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(1, 6, 0), kUint32Type, ValueSpan(5)), CHIP_ERROR_NO_MEMORY);
+    delegate.mScheduleError = CHIP_NO_ERROR;
+    size_t scheduleCount    = delegate.mScheduleCount;
+    EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(3, 6, 0), kUint32Type, ValueSpan(6)), CHIP_NO_ERROR);
+    EXPECT_EQ(delegate.mScheduleCount, scheduleCount + 1);
+    EXPECT_EQ(queue.Drain(), 2u);
+    EXPECT_EQ(ValueOf(delegate.mApplied.back()), 6u);
+}
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+TEST(TestAttributeUpdateQueue, TestConcurrentProducers)
+{
+    constexpr uint32_t kProducerCount        = 8;
+    constexpr uint32_t kUpdatesPerProducer   = 20000;
+    constexpr AttributeId kSharedAttributeId = 0xFF;
+
+    TestDelegate delegate;
+    AttributeUpdateQueueWithStorage<kProducerCount + 1> queue(delegate);
+    ASSERT_EQ(queue.Init(), CHIP_NO_ERROR);
+
+    // Each producer updates its own attribute and one shared by all of them
+    std::atomic<uint32_t> runningProducers{ kProducerCount };
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([&queue, &runningProducers, producer]() {
+            for (uint32_t value = 1; value <= kUpdatesPerProducer; value++)
+            {
+                EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(1, 0x0402, producer), kUint32Type, ValueSpan(value)), CHIP_NO_ERROR);
+                EXPECT_EQ(queue.Enqueue(ConcreteAttributePath(1, 0x0402, kSharedAttributeId), kUint32Type, ValueSpan(value)),
+                          CHIP_NO_ERROR);
+            }
+            runningProducers--;
+        });
+    }
+
+    // Drain concurrently, like the Matter thread would
+    uint32_t lastValues[kProducerCount] = {};
+    size_t applied                      = 0;
+    bool producing                      = true;
+    while (producing)
+    {
+        producing = (runningProducers != 0);
+        applied += queue.Drain();
+
+        for (const auto & update : delegate.mApplied)
+        {
+            if (update.path.mAttributeId == kSharedAttributeId)
+            {
+                continue;
+            }
+            ASSERT_LT(update.path.mAttributeId, kProducerCount);
+            uint32_t & lastValue = lastValues[update.path.mAttributeId];
+            // Values of an attribute are applied in the order they were queued
+            EXPECT_GT(ValueOf(update), lastValue);
+            lastValue = ValueOf(update);
+        }
+        delegate.mApplied.clear();
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    for (uint32_t lastValue : lastValues)
+    {
+        EXPECT_EQ(lastValue, kUpdatesPerProducer);
+    }
+
+    // Every update was either applied or superseded by a later one
+    EXPECT_EQ(applied, queue.GetAppliedUpdateCount());
+    EXPECT_EQ(queue.GetAppliedUpdateCount() + queue.GetCoalescedUpdateCount(), 2u * kProducerCount * kUpdatesPerProducer);
+}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+} // namespace
@@ -0,0 +1,478 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/BatchReadClient.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/ScopedNodeId.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace {
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Test;
+
+constexpr NodeId kUnreachableNodeId = 0xDEAD'BEEF'0000'0001;
+
+constexpr NodeId kSimulatedNodeIdBase        = 0x0000'B000'0000'0000;
+constexpr size_t kNumSimulatedNodes          = 300;
+constexpr uint16_t kSimulatedSessionIdBase   = 0x1000;
+constexpr size_t kLargeBatchMaxConcurrency   = 3;
+constexpr size_t kLargeBatchUnreachableEvery = 7;
+
+// In the large batch, every seventh node never gets a session, and fails as soon as it is started.
+bool IsReachableInLargeBatch(size_t aIndex)
+{
+    return aIndex % kLargeBatchUnreachableEvery != 3;
+}
+
+const MockNodeConfig & TestMockNodeConfig()
+{
+    using namespace chip::app::Clusters::Globals::Attributes;
+
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kTestEndpointId, {
+            MockClusterConfig(kTestClusterId, {
+                ClusterRevision::Id, FeatureMap::Id, 1, 2
+            }),
+        }),
+    });
+    // clang-format on
+    return config;
+}
+
+class TestBatchCallback : public BatchReadClient::Callback
+{
+public:
+    void OnAttributeData(const ScopedNodeId & aNode, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const StatusIB & aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mNumAttributeResponse++;
+        }
+    }
+
+    void OnNodeStatus(const ScopedNodeId & aNode, CHIP_ERROR aError) override
+    {
+        mNumNodeStatus++;
+        if (aError != CHIP_NO_ERROR)
+        {
+            mNumNodeFailures++;
+        }
+    }
+
+    void OnBatchDone(BatchReadClient & aBatch) override { mNumBatchDone++; }
+
+    int mNumAttributeResponse = 0;
+    int mNumNodeStatus        = 0;
+    int mNumNodeFailures      = 0;
+    int mNumBatchDone         = 0;
+};
+
+class DestroyOnBatchDoneCallback : public TestBatchCallback
+{
+public:
+    void OnBatchDone(BatchReadClient & aBatch) override
+    {
+        TestBatchCallback::OnBatchDone(aBatch);
+        EXPECT_EQ(&aBatch, mpBatch);
+        Platform::Delete(mpBatch);
+        mpBatch = nullptr;
+    }
+
+    BatchReadClient * mpBatch = nullptr;
+};
+
+} // namespace
+
+namespace chip {
+namespace app {
+
+class TestBatchReadClient : public Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        mSimulatedSessions = std::make_unique<SessionHolder[]>(2 * kNumSimulatedNodes);
+
+        // BatchReadClient only picks up existing CASE sessions.
+        ExpireSessionBobToAlice();
+        ExpireSessionAliceToBob();
+        ASSERT_EQ(CreateCASESessionBobToAlice(), CHIP_NO_ERROR);
+        ASSERT_EQ(CreateCASESessionAliceToBob(), CHIP_NO_ERROR);
+
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&TestImCustomDataModel::Instance());
+        chip::Test::SetMockNodeConfig(TestMockNodeConfig());
+    }
+
+    void TearDown() override
+    {
+        for (size_t i = 0; i < kNumSimulatedNodes; i++)
+        {
+            DisconnectSimulatedNode(i);
+        }
+        mSimulatedSessions.reset();
+
+        chip::Test::ResetMockNodeConfig();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+    // A simulated node is one more peer on Bob's fabric, served by the same IM engine as Alice through its own pair of CASE
+    // sessions.  The session table only holds a few dozen sessions, so nodes get connected as they are needed.
+    ScopedNodeId GetSimulatedNode(size_t aIndex) { return ScopedNodeId(kSimulatedNodeIdBase + aIndex, GetBobFabricIndex()); }
+
+    CHIP_ERROR ConnectSimulatedNode(size_t aIndex)
+    {
+        VerifyOrReturnError(aIndex < kNumSimulatedNodes, CHIP_ERROR_INVALID_ARGUMENT);
+
+        const auto clientSessionId = static_cast<uint16_t>(kSimulatedSessionIdBase + 2 * aIndex);
+        const auto serverSessionId = static_cast<uint16_t>(clientSessionId + 1);
+
+        ReturnErrorOnFailure(GetSecureSessionManager().InjectCaseSessionWithTestKey(
+            mSimulatedSessions[2 * aIndex], clientSessionId, serverSessionId, GetBobFabric()->GetNodeId(),
+            GetSimulatedNode(aIndex).GetNodeId(), GetBobFabricIndex(), GetAliceAddress(), CryptoContext::SessionRole::kInitiator));
+        return GetSecureSessionManager().InjectCaseSessionWithTestKey(
+            mSimulatedSessions[2 * aIndex + 1], serverSessionId, clientSessionId, GetSimulatedNode(aIndex).GetNodeId(),
+            GetBobFabric()->GetNodeId(), GetAliceFabricIndex(), GetBobAddress(), CryptoContext::SessionRole::kResponder);
+    }
+
+    void DisconnectSimulatedNode(size_t aIndex)
+    {
+        for (size_t i = 2 * aIndex; i < 2 * aIndex + 2; i++)
+        {
+            if (mSimulatedSessions[i])
+            {
+                mSimulatedSessions[i].Get().Value()->AsSecureSession()->MarkForEviction();
+            }
+        }
+    }
+
+protected:
+    ScopedNodeId GetAliceNode() { return ScopedNodeId(GetAliceFabric()->GetNodeId(), GetBobFabricIndex()); }
+
+    static void PrepareParams(ReadPrepareParams & aParams, AttributePathParams & aPath)
+    {
+        aPath.mEndpointId                    = kTestEndpointId;
+        aPath.mClusterId                     = kTestClusterId;
+        aPath.mAttributeId                   = 1;
+        aParams.mpAttributePathParamsList    = &aPath;
+        aParams.mAttributePathParamsListSize = 1;
+    }
+
+private:
+    chip::app::DataModel::Provider * mOldProvider = nullptr;
+    std::unique_ptr<SessionHolder[]> mSimulatedSessions;
+};
+
+// Records the status of every simulated node, and only keeps sessions to the nodes the batch may have started if it honours
+// its concurrency limit: the settled ones, plus kLargeBatchMaxConcurrency more.  A node started past that window has no
+// session and fails with CHIP_ERROR_NOT_CONNECTED.  Settled nodes are disconnected, to make room in the session table.
+class LargeBatchCallback : public BatchReadClient::Callback
+{
+public:
+    LargeBatchCallback(TestBatchReadClient & aContext) : mContext(aContext)
+    {
+        mStatus.fill(CHIP_ERROR_BUSY);
+        mNumStatus.fill(0);
+        mNumAttributeResponse.fill(0);
+    }
+
+    void ConnectWindow()
+    {
+        const size_t end = std::min(mNumSettled + kLargeBatchMaxConcurrency, kNumSimulatedNodes);
+        for (; mNextToConnect < end; mNextToConnect++)
+        {
+            if (IsReachableInLargeBatch(mNextToConnect))
+            {
+                EXPECT_EQ(mContext.ConnectSimulatedNode(mNextToConnect), CHIP_NO_ERROR);
+            }
+        }
+    }
+
+    void OnAttributeData(const ScopedNodeId & aNode, const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const StatusIB & aStatus) override
+    {
+        if (aStatus.IsSuccess())
+        {
+            mNumAttributeResponse[IndexOf(aNode)]++;
+        }
+    }
+
+    void OnNodeStatus(const ScopedNodeId & aNode, CHIP_ERROR aError) override
+    {
+        const size_t index = IndexOf(aNode);
+        mStatus[index]     = aError;
+        mNumStatus[index]++;
+        mNumSettled++;
+
+        mContext.DisconnectSimulatedNode(index);
+        ConnectWindow();
+    }
+
+    void OnBatchDone(BatchReadClient & aBatch) override { mNumBatchDone++; }
+
+    std::array<CHIP_ERROR, kNumSimulatedNodes> mStatus;
+    std::array<int, kNumSimulatedNodes> mNumStatus;
+    std::array<int, kNumSimulatedNodes> mNumAttributeResponse;
+    int mNumBatchDone = 0;
+
+private:
+    static size_t IndexOf(const ScopedNodeId & aNode) { return static_cast<size_t>(aNode.GetNodeId() - kSimulatedNodeIdBase); }
+
+    TestBatchReadClient & mContext;
+    size_t mNumSettled    = 0;
+    size_t mNextToConnect = 0;
+};
+
+TEST_F(TestBatchReadClient, TestInvalidRequests)
+{
+    TestBatchCallback callback;
+    BatchReadClient batch(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                          ReadClient::InteractionType::Read);
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    const ScopedNodeId nodes[] = { GetAliceNode() };
+
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(), params), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_ERROR_INVALID_ARGUMENT);
+
+    PrepareParams(params, path);
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params, 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const ScopedNodeId duplicates[] = { GetAliceNode(), GetSimulatedNode(0), GetAliceNode() };
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(duplicates), params), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(batch.GetNodeStatus(GetAliceNode()), CHIP_ERROR_KEY_NOT_FOUND);
+
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_NO_ERROR);
+    EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_ERROR_INCORRECT_STATE);
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(callback.mNumBatchDone, 1);
+    EXPECT_EQ(batch.GetNodeStatus(GetAliceNode()), CHIP_NO_ERROR);
+}
+
+TEST_F(TestBatchReadClient, TestPacedReadBatch)
+{
+    TestBatchCallback callback;
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    PrepareParams(params, path);
+
+    ASSERT_EQ(ConnectSimulatedNode(0), CHIP_NO_ERROR);
+    ASSERT_EQ(ConnectSimulatedNode(1), CHIP_NO_ERROR);
+
+    const ScopedNodeId unreachable(kUnreachableNodeId, GetBobFabricIndex());
+    const ScopedNodeId nodes[] = { GetAliceNode(), unreachable, GetSimulatedNode(0), GetSimulatedNode(1) };
+
+    {
+        BatchReadClient batch(engine, &GetExchangeManager(), callback, ReadClient::InteractionType::Read);
+
+        // One node at a time: only the first read is in flight until it completes.
+        EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params, 1), CHIP_NO_ERROR);
+        EXPECT_EQ(batch.GetNodeCount(), ArraySize(nodes));
+        EXPECT_EQ(batch.GetSettledNodeCount(), 0u);
+        EXPECT_EQ(batch.GetNodeStatus(unreachable), CHIP_ERROR_BUSY);
+        EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 1u);
+
+        DrainAndServiceIO();
+
+        // There is no CASE session to the unreachable node, and no CASESessionManager to establish one.
+        EXPECT_EQ(callback.mNumBatchDone, 1);
+        EXPECT_EQ(callback.mNumNodeStatus, 4);
+        EXPECT_EQ(callback.mNumNodeFailures, 1);
+        EXPECT_EQ(callback.mNumAttributeResponse, 3);
+        EXPECT_EQ(batch.GetSettledNodeCount(), ArraySize(nodes));
+        EXPECT_EQ(batch.GetFailedNodeCount(), 1u);
+        EXPECT_EQ(batch.GetNodeStatus(GetAliceNode()), CHIP_NO_ERROR);
+        EXPECT_EQ(batch.GetNodeStatus(unreachable), CHIP_ERROR_NOT_CONNECTED);
+        EXPECT_EQ(batch.GetNodeStatus(GetSimulatedNode(0)), CHIP_NO_ERROR);
+        EXPECT_EQ(batch.GetNodeStatus(GetSimulatedNode(1)), CHIP_NO_ERROR);
+    }
+
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestBatchReadClient, TestSubscribeBatch)
+{
+    TestBatchCallback callback;
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    PrepareParams(params, path);
+    params.mMinIntervalFloorSeconds   = 0;
+    params.mMaxIntervalCeilingSeconds = 10;
+    params.mKeepSubscriptions         = true; // the simulated node is served by the same publisher as Alice
+
+    ASSERT_EQ(ConnectSimulatedNode(0), CHIP_NO_ERROR);
+    const ScopedNodeId nodes[] = { GetAliceNode(), GetSimulatedNode(0) };
+
+    {
+        BatchReadClient batch(engine, &GetExchangeManager(), callback, ReadClient::InteractionType::Subscribe);
+
+        EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(callback.mNumBatchDone, 1);
+        EXPECT_EQ(callback.mNumNodeStatus, 2);
+        EXPECT_EQ(callback.mNumNodeFailures, 0);
+        EXPECT_EQ(callback.mNumAttributeResponse, 2);
+        EXPECT_EQ(engine->GetNumActiveReadClients(), 2u);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 2u);
+    }
+
+    // Destroying the batch tears down the subscriptions without calling back.
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    EXPECT_EQ(callback.mNumNodeStatus, 2);
+
+    // The publisher side is not told about the subscriptions going away.
+    engine->ShutdownActiveReads();
+}
+
+TEST_F(TestBatchReadClient, TestDestroyFromBatchDone)
+{
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    PrepareParams(params, path);
+    params.mMinIntervalFloorSeconds   = 0;
+    params.mMaxIntervalCeilingSeconds = 10;
+    params.mKeepSubscriptions         = true; // the simulated node is served by the same publisher as Alice
+
+    ASSERT_EQ(ConnectSimulatedNode(0), CHIP_NO_ERROR);
+    const ScopedNodeId nodes[] = { GetAliceNode(), GetSimulatedNode(0) };
+
+    // The last node settles from within ReadClient::OnDone for a read, and from within
+    // OnSubscriptionEstablished for a subscription.
+    for (auto interactionType : { ReadClient::InteractionType::Read, ReadClient::InteractionType::Subscribe })
+    {
+        DestroyOnBatchDoneCallback callback;
+        callback.mpBatch = Platform::New<BatchReadClient>(engine, &GetExchangeManager(), callback, interactionType);
+        ASSERT_NE(callback.mpBatch, nullptr);
+
+        EXPECT_EQ(callback.mpBatch->SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(callback.mNumBatchDone, 1);
+        EXPECT_EQ(callback.mNumNodeStatus, 2);
+        EXPECT_EQ(callback.mNumNodeFailures, 0);
+        EXPECT_EQ(callback.mpBatch, nullptr);
+        EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    }
+
+    engine->ShutdownActiveReads();
+    DrainAndServiceIO();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestBatchReadClient, TestLargeReadBatch)
+{
+    LargeBatchCallback callback(*this);
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    PrepareParams(params, path);
+
+    std::unique_ptr<ScopedNodeId[]> nodes = std::make_unique<ScopedNodeId[]>(kNumSimulatedNodes);
+    size_t numUnreachable                 = 0;
+    for (size_t i = 0; i < kNumSimulatedNodes; i++)
+    {
+        nodes[i] = GetSimulatedNode(i);
+        numUnreachable += IsReachableInLargeBatch(i) ? 0 : 1;
+    }
+
+    {
+        BatchReadClient batch(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+
+        callback.ConnectWindow();
+        EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes.get(), kNumSimulatedNodes), params, kLargeBatchMaxConcurrency),
+                  CHIP_NO_ERROR);
+
+        // The first nodes are all reachable: exactly as many reads as allowed are in flight.
+        EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), kLargeBatchMaxConcurrency);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(callback.mNumBatchDone, 1);
+        EXPECT_EQ(batch.GetSettledNodeCount(), kNumSimulatedNodes);
+        EXPECT_EQ(batch.GetFailedNodeCount(), numUnreachable);
+
+        for (size_t i = 0; i < kNumSimulatedNodes; i++)
+        {
+            const CHIP_ERROR expected = IsReachableInLargeBatch(i) ? CHIP_NO_ERROR : CHIP_ERROR_NOT_CONNECTED;
+            EXPECT_EQ(callback.mNumStatus[i], 1);
+            EXPECT_EQ(callback.mStatus[i], expected);
+            EXPECT_EQ(batch.GetNodeStatus(GetSimulatedNode(i)), expected);
+            EXPECT_EQ(callback.mNumAttributeResponse[i], IsReachableInLargeBatch(i) ? 1 : 0);
+        }
+    }
+
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestBatchReadClient, TestDestroyBeforeBatchDone)
+{
+    TestBatchCallback callback;
+
+    AttributePathParams path;
+    ReadPrepareParams params;
+    PrepareParams(params, path);
+
+    const ScopedNodeId nodes[] = { ScopedNodeId(kUnreachableNodeId, GetBobFabricIndex()) };
+
+    {
+        BatchReadClient batch(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+
+        // The node fails right away, but the completion of the batch is only reported from the event loop.
+        EXPECT_EQ(batch.SendRequest(Span<const ScopedNodeId>(nodes), params), CHIP_NO_ERROR);
+        EXPECT_EQ(batch.GetSettledNodeCount(), 1u);
+        EXPECT_EQ(callback.mNumNodeStatus, 1);
+        EXPECT_EQ(callback.mNumBatchDone, 0);
+    }
+
+    // Destroying the batch cancelled the pending completion.
+    DrainAndServiceIO();
+    EXPECT_EQ(callback.mNumBatchDone, 0);
+}
+
+} // namespace app
+} // namespace chip
@@ -21,7 +21,9 @@
 
 #include <app/CommandHandlerInterfaceRegistry.h>
 
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace chip {
 namespace app {
@@ -99,5 +101,49 @@ TEST(TestCommandHandlerInterfaceRegistry, TestUnregisterAll)
     EXPECT_EQ(registry.GetCommandHandler(5, 3), &d);
 }
 
+TEST(TestCommandHandlerInterfaceRegistry, TestManyHandlers)
+{
+    // Enough handlers for lookups to go through the index, and then too many for it
+    constexpr size_t kOverIndexCapacity = CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS / 2 + 20;
+    for (size_t handlerCount : { static_cast<size_t>(500), kOverIndexCapacity })
+    {
+        std::vector<std::unique_ptr<TestCommandHandlerInterface>> handlers;
+        CommandHandlerInterfaceRegistry registry;
+
+        // A bridge with a handful of clusters on each of many endpoints, and one handler for all endpoints
+        for (size_t i = 0; i < handlerCount; i++)
+        {
+            handlers.push_back(std::make_unique<TestCommandHandlerInterface>(Optional<EndpointId>(static_cast<EndpointId>(i / 5)),
+                                                                             static_cast<ClusterId>(i % 5)));
+            ASSERT_EQ(registry.RegisterCommandHandler(handlers.back().get()), CHIP_NO_ERROR);
+        }
+        TestCommandHandlerInterface wildcard(NullOptional, 0xFFF1FC00);
+        ASSERT_EQ(registry.RegisterCommandHandler(&wildcard), CHIP_NO_ERROR);
+
+        for (size_t i = 0; i < handlerCount; i++)
+        {
+            EXPECT_EQ(registry.GetCommandHandler(static_cast<EndpointId>(i / 5), static_cast<ClusterId>(i % 5)), handlers[i].get());
+        }
+        EXPECT_EQ(registry.GetCommandHandler(0, 5), nullptr);
+        EXPECT_EQ(registry.GetCommandHandler(static_cast<EndpointId>(handlerCount), 0), nullptr);
+        EXPECT_EQ(registry.GetCommandHandler(3, 0xFFF1FC00), &wildcard);
+
+        // Lookups stay consistent with the list as handlers come and go
+        registry.UnregisterAllCommandHandlersForEndpoint(1);
+        EXPECT_EQ(registry.UnregisterCommandHandler(handlers[0].get()), CHIP_NO_ERROR);
+        EXPECT_EQ(registry.GetCommandHandler(0, 0), nullptr);
+        EXPECT_EQ(registry.GetCommandHandler(0, 1), handlers[1].get());
+        EXPECT_EQ(registry.GetCommandHandler(1, 0), nullptr);
+        EXPECT_EQ(registry.GetCommandHandler(2, 0), handlers[10].get());
+
+        ASSERT_EQ(registry.RegisterCommandHandler(handlers[5].get()), CHIP_NO_ERROR);
+        EXPECT_EQ(registry.GetCommandHandler(1, 0), handlers[5].get());
+
+        registry.UnregisterAllHandlers();
+        EXPECT_EQ(registry.GetCommandHandler(2, 0), nullptr);
+        EXPECT_EQ(registry.GetCommandHandler(3, 0xFFF1FC00), nullptr);
+    }
+}
+
 } // namespace app
 } // namespace chip
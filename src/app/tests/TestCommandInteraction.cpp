@@ -29,6 +29,7 @@
 
 #include <app/AppConfig.h>
 #include <app/CommandHandlerImpl.h>
+#include <app/CommandResponseSender.h>
 #include <app/InteractionModelEngine.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/data-model/Encode.h>
@@ -74,6 +75,8 @@ size_t commandDispatchedCount = 0;
 
 bool sendResponse = true;
 bool asyncCommand = false;
+// Whether the command that goes async adds its response later, through asyncCommandHandle.
+bool asyncCommandRespondsLater = false;
 
 constexpr EndpointId kTestEndpointId                      = 1;
 constexpr ClusterId kTestClusterId                        = 3;
@@ -249,13 +252,16 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aRequestCommandPat
 
     EXPECT_EQ(aReader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
 
+    bool respondLater = false;
     if (asyncCommand)
     {
-        asyncCommandHandle = apCommandObj;
-        asyncCommand       = false;
+        asyncCommandHandle        = apCommandObj;
+        asyncCommand              = false;
+        respondLater              = asyncCommandRespondsLater;
+        asyncCommandRespondsLater = false;
     }
 
-    if (sendResponse)
+    if (sendResponse && !respondLater)
     {
         if (aRequestCommandPath.mCommandId == kTestCommandIdNoData || aRequestCommandPath.mCommandId == kTestCommandIdWithData)
         {
@@ -356,11 +362,13 @@ public:
 
     void AddInvokeResponseToSend(System::PacketBufferHandle && aPacket) override { mChunks.AddToEnd(std::move(aPacket)); }
     void ResponseDropped() override { mResponseDropped = true; }
+    bool CanSendInvokeResponsesEarly() override { return mSendResponsesEarly; }
 
     size_t GetCommandResponseMaxBufferSize() override { return kMaxSecureSduLengthBytes; }
 
     System::PacketBufferHandle mChunks;
-    bool mResponseDropped = false;
+    bool mResponseDropped    = false;
+    bool mSendResponsesEarly = false;
 };
 
 class MockCommandHandlerCallback : public CommandHandlerImpl::Callback
@@ -450,6 +458,10 @@ public:
     void TestCommandHandler_RejectsMultipleCommandsWithIdenticalCommandRef();
     void TestCommandHandler_RejectMultipleCommandsWhenHandlerOnlySupportsOne();
     void TestCommandHandler_AcceptMultipleCommands();
+    void TestCommandHandler_SendsReadyResponsesEarly();
+    void TestCommandResponseSender_WaitsForPendingWorkAfterChunkAck();
+    void TestCommandResponseSender_DoneWhileAwaitingChunkAck();
+    void TestCommandResponseSender_CloseWithPendingWork();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsStatusResponse();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponsePrimative();
     void TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsDataResponse();
@@ -488,6 +500,9 @@ public:
                                        std::optional<uint16_t> aCommandRef = std::nullopt);
     static void AddInvokeRequestData(CommandSender * apCommandSender, CommandId aCommandId = kTestCommandIdWithData);
     static void AddInvalidInvokeRequestData(CommandSender * apCommandSender, CommandId aCommandId = kTestCommandIdWithData);
+    // Add a batch of two commands: kTestCommandIdWithData with CommandRef 0, then
+    // kTestCommandIdCommandSpecificResponse with CommandRef 1.
+    static void AddBatchInvokeRequestData(CommandSender * apCommandSender);
     static void AddInvokeResponseData(CommandHandler * apCommandHandler, bool aNeedStatusCode,
                                       CommandId aResponseCommandId = kTestCommandIdWithData,
                                       CommandId aRequestCommandId  = kTestCommandIdWithData);
@@ -512,6 +527,62 @@ class TestExchangeDelegate : public Messaging::ExchangeDelegate
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
 };
 
+/**
+ * Serves InvokeRequests in place of the InteractionModelEngine, with a CommandResponseSender that sends ready
+ * responses early and accepts batch commands, which CHIP_CONFIG_MAX_PATHS_PER_INVOKE does not allow on host builds.
+ */
+class EarlyInvokeResponsesServer : public Messaging::UnsolicitedMessageHandler,
+                                   public Messaging::ExchangeDelegate,
+                                   public CommandResponseSender::Callback
+{
+public:
+    EarlyInvokeResponsesServer(Messaging::ExchangeManager & aExchangeManager) : mExchangeManager(aExchangeManager)
+    {
+        EXPECT_EQ(mExchangeManager.UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id), CHIP_NO_ERROR);
+        EXPECT_EQ(mExchangeManager.RegisterUnsolicitedMessageHandlerForType(
+                      Protocols::InteractionModel::MsgType::InvokeCommandRequest, this),
+                  CHIP_NO_ERROR);
+    }
+
+    ~EarlyInvokeResponsesServer()
+    {
+        EXPECT_EQ(
+            mExchangeManager.UnregisterUnsolicitedMessageHandlerForType(Protocols::InteractionModel::MsgType::InvokeCommandRequest),
+            CHIP_NO_ERROR);
+        EXPECT_EQ(mExchangeManager.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id,
+                                                                               InteractionModelEngine::GetInstance()),
+                  CHIP_NO_ERROR);
+    }
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader,
+                                            Messaging::ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        VerifyOrReturnError(!mResponder.has_value(), CHIP_ERROR_BUSY);
+        mResponder.emplace(this, &mockCommandHandlerDelegate, mTestOnlyOverrides);
+        mResponder->SetSendResponsesEarly(true);
+        mResponder->OnInvokeCommandRequest(ec, std::move(payload), /* isTimedInvoke = */ false);
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+
+    void OnDone(CommandResponseSender & apResponderObj) override { mResponder.reset(); }
+
+    std::optional<CommandResponseSender> mResponder;
+
+private:
+    Messaging::ExchangeManager & mExchangeManager;
+    BasicCommandPathRegistry<4> mCommandPathRegistry;
+    CommandHandlerImpl::TestOnlyOverrides mTestOnlyOverrides{ &mCommandPathRegistry, nullptr };
+};
+
 CommandPathParams MakeTestCommandPath(CommandId aCommandId = kTestCommandIdWithData)
 {
     return CommandPathParams(kTestEndpointId, 0, kTestClusterId, aCommandId, (chip::app::CommandPathFlags::kEndpointIdValid));
@@ -650,6 +721,30 @@ void TestCommandInteraction::AddInvalidInvokeRequestData(CommandSender * apComma
     apCommandSender->MoveToState(CommandSender::State::AddedCommand);
 }
 
+void TestCommandInteraction::AddBatchInvokeRequestData(CommandSender * apCommandSender)
+{
+    CommandSender::ConfigParameters configParameters;
+    configParameters.SetRemoteMaxPathsPerInvoke(2);
+    EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->SetCommandSenderConfig(configParameters));
+
+    CommandPathParams requestCommandPaths[] = {
+        MakeTestCommandPath(kTestCommandIdWithData),
+        MakeTestCommandPath(kTestCommandIdCommandSpecificResponse),
+    };
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        CommandSender::PrepareCommandParameters prepareCommandParams;
+        prepareCommandParams.SetStartDataStruct(true);
+        prepareCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->PrepareCommand(requestCommandPaths[i], prepareCommandParams));
+        EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->GetCommandDataIBTLVWriter()->PutBoolean(chip::TLV::ContextTag(1), true));
+        CommandSender::FinishCommandParameters finishCommandParams;
+        finishCommandParams.SetEndDataStruct(true);
+        finishCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, apCommandSender->FinishCommand(finishCommandParams));
+    }
+}
+
 void TestCommandInteraction::AddInvokeResponseData(CommandHandler * apCommandHandler, bool aNeedStatusCode,
                                                    CommandId aResponseCommandId, CommandId aRequestCommandId)
 {
@@ -1878,6 +1973,205 @@ TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_AcceptMultipleCom
     EXPECT_EQ(commandDispatchedCount, 2u);
 }
 
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_SendsReadyResponsesEarly)
+{
+    mockCommandSenderExtendedDelegate.ResetCounter();
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &mockCommandSenderExtendedDelegate, &GetExchangeManager(),
+                                     &pendingResponseTracker);
+
+    app::CommandSender::ConfigParameters configParameters;
+    configParameters.SetRemoteMaxPathsPerInvoke(2);
+    EXPECT_EQ(CHIP_NO_ERROR, commandSender.SetCommandSenderConfig(configParameters));
+
+    CommandPathParams requestCommandPaths[] = {
+        MakeTestCommandPath(kTestCommandIdWithData),
+        MakeTestCommandPath(kTestCommandIdCommandSpecificResponse),
+    };
+    for (uint16_t i = 0; i < 2; i++)
+    {
+        app::CommandSender::PrepareCommandParameters prepareCommandParams;
+        prepareCommandParams.SetStartDataStruct(true);
+        prepareCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, commandSender.PrepareCommand(requestCommandPaths[i], prepareCommandParams));
+        EXPECT_EQ(CHIP_NO_ERROR, commandSender.GetCommandDataIBTLVWriter()->PutBoolean(chip::TLV::ContextTag(1), true));
+        app::CommandSender::FinishCommandParameters finishCommandParams;
+        finishCommandParams.SetEndDataStruct(true);
+        finishCommandParams.SetCommandRef(i);
+        EXPECT_EQ(CHIP_NO_ERROR, commandSender.FinishCommand(finishCommandParams));
+    }
+    commandSender.MoveToState(app::CommandSender::State::AddedCommand);
+
+    BasicCommandPathRegistry<4> basicCommandPathRegistry;
+    MockCommandResponder mockCommandResponder;
+    mockCommandResponder.mSendResponsesEarly = true;
+    CommandHandlerImpl::TestOnlyOverrides testOnlyOverrides{ &basicCommandPathRegistry, &mockCommandResponder };
+    CommandHandlerImpl commandHandler(testOnlyOverrides, &mockCommandHandlerDelegate);
+
+    // Hackery to steal the InvokeRequest buffer from commandSender.
+    System::PacketBufferHandle commandDatabuf;
+    EXPECT_EQ(commandSender.Finalize(commandDatabuf), CHIP_NO_ERROR);
+
+    // The first command goes async, and responds after the second one.
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+    mockCommandHandlerDelegate.ResetCounter();
+    commandDispatchedCount = 0;
+
+    Protocols::InteractionModel::Status status =
+        commandHandler.OnInvokeCommandRequest(mockCommandResponder, std::move(commandDatabuf), false);
+    EXPECT_EQ(status, Protocols::InteractionModel::Status::Success);
+    EXPECT_EQ(commandDispatchedCount, 2u);
+    ASSERT_NE(asyncCommandHandle.Get(), nullptr);
+
+    // Checks that the next chunk holds the response to the given command, and only that.
+    auto checkNextChunk = [&mockCommandResponder](uint16_t expectedRef, bool expectMoreChunks) {
+        ASSERT_FALSE(mockCommandResponder.mChunks.IsNull());
+        System::PacketBufferTLVReader reader;
+        reader.Init(mockCommandResponder.mChunks.PopHead());
+
+        InvokeResponseMessage::Parser invokeResponseMessage;
+        ASSERT_EQ(invokeResponseMessage.Init(reader), CHIP_NO_ERROR);
+        bool moreChunkedMessages = false;
+        CHIP_ERROR err           = invokeResponseMessage.GetMoreChunkedMessages(&moreChunkedMessages);
+        EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+        EXPECT_EQ(moreChunkedMessages, expectMoreChunks);
+
+        InvokeResponseIBs::Parser invokeResponses;
+        ASSERT_EQ(invokeResponseMessage.GetInvokeResponses(&invokeResponses), CHIP_NO_ERROR);
+        TLV::TLVReader invokeResponsesReader;
+        invokeResponses.GetReader(&invokeResponsesReader);
+        ASSERT_EQ(invokeResponsesReader.Next(), CHIP_NO_ERROR);
+
+        InvokeResponseIB::Parser invokeResponse;
+        ASSERT_EQ(invokeResponse.Init(invokeResponsesReader), CHIP_NO_ERROR);
+        CommandDataIB::Parser commandData;
+        CommandStatusIB::Parser commandStatus;
+        uint16_t ref = UINT16_MAX;
+        if (invokeResponse.GetCommand(&commandData) == CHIP_NO_ERROR)
+        {
+            EXPECT_EQ(commandData.GetRef(&ref), CHIP_NO_ERROR);
+        }
+        else
+        {
+            ASSERT_EQ(invokeResponse.GetStatus(&commandStatus), CHIP_NO_ERROR);
+            EXPECT_EQ(commandStatus.GetRef(&ref), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(ref, expectedRef);
+        EXPECT_EQ(invokeResponsesReader.Next(), CHIP_END_OF_TLV);
+    };
+
+    // The response to the second command did not wait for the first one.
+    checkNextChunk(/* expectedRef = */ 1, /* expectMoreChunks = */ true);
+    EXPECT_TRUE(mockCommandResponder.mChunks.IsNull());
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 0);
+
+    asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdWithData),
+                                        Protocols::InteractionModel::Status::Success);
+    asyncCommandHandle = nullptr;
+
+    checkNextChunk(/* expectedRef = */ 0, /* expectMoreChunks = */ false);
+    EXPECT_TRUE(mockCommandResponder.mChunks.IsNull());
+    EXPECT_EQ(mockCommandHandlerDelegate.onFinalCalledTimes, 1);
+}
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_WaitsForPendingWorkAfterChunkAck)
+{
+    EarlyInvokeResponsesServer server(GetExchangeManager());
+
+    mockCommandSenderExtendedDelegate.ResetCounter();
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &mockCommandSenderExtendedDelegate, &GetExchangeManager(),
+                                     &pendingResponseTracker);
+    AddBatchInvokeRequestData(&commandSender);
+
+    // The first command goes async, and responds after the second one.
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+
+    EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    // The response to the second command was sent and acknowledged, and the responder now waits for the first one.
+    ASSERT_TRUE(server.mResponder.has_value());
+    EXPECT_EQ(server.mResponder->mState, CommandResponseSender::State::ReadyForInvokeResponses);
+    EXPECT_TRUE(server.mResponder->mCommandHandler.HasPendingWork());
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onResponseCalledTimes, 1);
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onFinalCalledTimes, 0);
+    EXPECT_EQ(commandSender.GetInvokeResponseMessageCount(), 1u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 2u);
+
+    ASSERT_NE(asyncCommandHandle.Get(), nullptr);
+    asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdWithData),
+                                        Protocols::InteractionModel::Status::Success);
+    asyncCommandHandle = nullptr;
+
+    DrainAndServiceIO();
+
+    EXPECT_FALSE(server.mResponder.has_value());
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onResponseCalledTimes, 2);
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onNoResponseCalledTimes, 0);
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onErrorCalledTimes, 0);
+    EXPECT_EQ(mockCommandSenderExtendedDelegate.onFinalCalledTimes, 1);
+    EXPECT_EQ(commandSender.GetInvokeResponseMessageCount(), 2u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_DoneWhileAwaitingChunkAck)
+{
+    EarlyInvokeResponsesServer server(GetExchangeManager());
+
+    // Completes the async command while the responder waits for the first chunk to be acknowledged.
+    class CompleteAsyncCommandCallback : public MockCommandSenderExtendableCallback
+    {
+    public:
+        CompleteAsyncCommandCallback(EarlyInvokeResponsesServer & aServer) : mServer(aServer) {}
+
+        void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+        {
+            MockCommandSenderExtendableCallback::OnResponse(apCommandSender, aResponseData);
+            VerifyOrReturn(asyncCommandHandle.Get() != nullptr);
+
+            ASSERT_TRUE(mServer.mResponder.has_value());
+            EXPECT_EQ(mServer.mResponder->mState, CommandResponseSender::State::AwaitingStatusResponse);
+            asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdWithData),
+                                                Protocols::InteractionModel::Status::Success);
+            asyncCommandHandle = nullptr;
+
+            // The CommandHandler is done, but the last chunk is only sent once the first one is acknowledged.
+            ASSERT_TRUE(mServer.mResponder.has_value());
+            EXPECT_FALSE(mServer.mResponder->mCommandHandler.HasPendingWork());
+            EXPECT_EQ(mServer.mResponder->mState, CommandResponseSender::State::AwaitingStatusResponse);
+        }
+
+        EarlyInvokeResponsesServer & mServer;
+    } callback(server);
+
+    PendingResponseTrackerImpl pendingResponseTracker;
+    app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &callback, &GetExchangeManager(), &pendingResponseTracker);
+    AddBatchInvokeRequestData(&commandSender);
+
+    sendResponse              = true;
+    asyncCommand              = true;
+    asyncCommandRespondsLater = true;
+
+    EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(asyncCommandHandle.Get(), nullptr);
+    EXPECT_FALSE(server.mResponder.has_value());
+    EXPECT_EQ(callback.onResponseCalledTimes, 2);
+    EXPECT_EQ(callback.onNoResponseCalledTimes, 0);
+    EXPECT_EQ(callback.onErrorCalledTimes, 0);
+    EXPECT_EQ(callback.onFinalCalledTimes, 1);
+    EXPECT_EQ(commandSender.GetInvokeResponseMessageCount(), 2u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_FillUpInvokeResponseMessageWhereSecondResponseIsStatusResponse)
 {
     BasicCommandPathRegistry<4> basicCommandPathRegistry;
@@ -1989,6 +2283,73 @@ TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandHandler_ReleaseWithExchan
     asyncCommandHandle.Get()->GetExchangeContext()->OnSessionReleased();
     asyncCommandHandle = nullptr;
 }
+
+TEST_F_FROM_FIXTURE(TestCommandInteraction, TestCommandResponseSender_CloseWithPendingWork)
+{
+    EarlyInvokeResponsesServer server(GetExchangeManager());
+
+    // Mimics the responder timing out on the first chunk, while the first command is still pending, by releasing
+    // the session on its exchange before the requester acknowledges the chunk.
+    class ReleaseResponderSessionCallback : public MockCommandSenderExtendableCallback
+    {
+    public:
+        ReleaseResponderSessionCallback(EarlyInvokeResponsesServer & aServer) : mServer(aServer) {}
+
+        void OnResponse(CommandSender * apCommandSender, const CommandSender::ResponseData & aResponseData) override
+        {
+            MockCommandSenderExtendableCallback::OnResponse(apCommandSender, aResponseData);
+
+            ASSERT_TRUE(mServer.mResponder.has_value());
+            EXPECT_EQ(mServer.mResponder->mState, CommandResponseSender::State::AwaitingStatusResponse);
+            Messaging::ExchangeContext * exchange = mServer.mResponder->mExchangeCtx.Get();
+            ASSERT_NE(exchange, nullptr);
+            exchange->GetSessionHolder().Release();
+            exchange->OnSessionReleased();
+
+            // The responder has to outlive the CommandHandler, but no longer has an exchange to send on.
+            ASSERT_TRUE(mServer.mResponder.has_value());
+            EXPECT_EQ(mServer.mResponder->mState, CommandResponseSender::State::ErrorSentDelayCloseUntilOnDone);
+            EXPECT_EQ(mServer.mResponder->mExchangeCtx.Get(), nullptr);
+        }
+
+        EarlyInvokeResponsesServer & mServer;
+    } callback(server);
+
+    {
+        PendingResponseTrackerImpl pendingResponseTracker;
+        app::CommandSender commandSender(kCommandSenderTestOnlyMarker, &callback, &GetExchangeManager(), &pendingResponseTracker);
+        AddBatchInvokeRequestData(&commandSender);
+
+        sendResponse              = true;
+        asyncCommand              = true;
+        asyncCommandRespondsLater = true;
+
+        EXPECT_EQ(commandSender.SendCommandRequest(GetSessionBobToAlice()), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(callback.onResponseCalledTimes, 1);
+        ASSERT_TRUE(server.mResponder.has_value());
+        EXPECT_EQ(server.mResponder->mState, CommandResponseSender::State::ErrorSentDelayCloseUntilOnDone);
+
+        // The response to the first command is dropped, and the responder is done along with the CommandHandler.
+        ASSERT_NE(asyncCommandHandle.Get(), nullptr);
+        asyncCommandHandle.Get()->AddStatus(ConcreteCommandPath(kTestEndpointId, kTestClusterId, kTestCommandIdWithData),
+                                            Protocols::InteractionModel::Status::Success);
+        asyncCommandHandle = nullptr;
+
+        DrainAndServiceIO();
+
+        EXPECT_FALSE(server.mResponder.has_value());
+        EXPECT_EQ(callback.onResponseCalledTimes, 1);
+        EXPECT_EQ(callback.onFinalCalledTimes, 0);
+        EXPECT_EQ(commandSender.GetInvokeResponseMessageCount(), 1u);
+    }
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
 #endif
 
 } // namespace app
@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/util/persistence/DefaultAttributePersistenceProvider.h>
+#include <app/util/persistence/DeferredAttributePersistenceProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <platform/CHIPDeviceLayer.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+const ConcreteAttributePath kDeferredPath(1, Clusters::LevelControl::Id, Clusters::LevelControl::Attributes::CurrentLevel::Id);
+const ConcreteAttributePath kImmediatePath(1, Clusters::OnOff::Id, Clusters::OnOff::Attributes::OnOff::Id);
+
+EmberAfAttributeMetadata gUint8Metadata = {
+    .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(static_cast<uint8_t>(0)),
+    .attributeId   = Clusters::LevelControl::Attributes::CurrentLevel::Id,
+    .size          = 1,
+    .attributeType = ZCL_INT8U_ATTRIBUTE_TYPE,
+    .mask          = ATTRIBUTE_MASK_WRITABLE,
+};
+
+constexpr System::Clock::Milliseconds32 kWriteDelay(60 * 1000);
+
+CHIP_ERROR WriteUint8(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t value)
+{
+    return provider.WriteValue(path, ByteSpan(&value, sizeof(value)));
+}
+
+CHIP_ERROR ReadUint8(AttributePersistenceProvider & provider, const ConcreteAttributePath & path, uint8_t & value)
+{
+    MutableByteSpan buffer(&value, sizeof(value));
+    ReturnErrorOnFailure(provider.ReadValue(path, &gUint8Metadata, buffer));
+    VerifyOrReturnError(buffer.size() == sizeof(value), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+class TestDeferredAttributePersistenceProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::PlatformMgr().Shutdown();
+        Platform::MemoryShutdown();
+    }
+};
+
+TEST_F(TestDeferredAttributePersistenceProvider, TestCoalescedWrites)
+{
+    TestPersistentStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    ASSERT_EQ(persister.Init(&storage), CHIP_NO_ERROR);
+
+    DeferredAttribute deferredAttributes[] = { DeferredAttribute(kDeferredPath) };
+    DeferredAttributePersistenceProvider deferred(persister, Span<DeferredAttribute>(deferredAttributes), kWriteDelay);
+
+    for (uint8_t level = 1; level <= 10; level++)
+    {
+        EXPECT_EQ(WriteUint8(deferred, kDeferredPath, level), CHIP_NO_ERROR);
+    }
+
+    // Nothing reached the storage yet, but reads return the last written value.
+    uint8_t value = 0;
+    EXPECT_EQ(storage.GetNumKeys(), 0u);
+    EXPECT_EQ(ReadUint8(deferred, kDeferredPath, value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 10);
+    EXPECT_EQ(deferred.GetAbsorbedWriteCount(), 9u);
+    EXPECT_EQ(deferred.GetFlushedWriteCount(), 0u);
+
+    // Attributes that are not deferred are written through.
+    EXPECT_EQ(WriteUint8(deferred, kImmediatePath, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 1u);
+
+    EXPECT_EQ(deferred.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumKeys(), 2u);
+    EXPECT_EQ(deferred.GetFlushedWriteCount(), 1u);
+
+    // Flushing again does not write anything.
+    EXPECT_EQ(deferred.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(deferred.GetFlushedWriteCount(), 1u);
+
+    EXPECT_EQ(ReadUint8(persister, kDeferredPath, value), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 10);
+}
+
+TEST_F(TestDeferredAttributePersistenceProvider, TestLastValueWinsAfterRestart)
+{
+    TestPersistentStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    ASSERT_EQ(persister.Init(&storage), CHIP_NO_ERROR);
+
+    DeferredAttribute deferredAttributes[] = { DeferredAttribute(kDeferredPath) };
+    DeferredAttributePersistenceProvider deferred(persister, Span<DeferredAttribute>(deferredAttributes), kWriteDelay);
+
+    EXPECT_EQ(WriteUint8(deferred, kDeferredPath, 5), CHIP_NO_ERROR);
+    EXPECT_EQ(deferred.Flush(), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteUint8(deferred, kDeferredPath, 6), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteUint8(deferred, kDeferredPath, 7), CHIP_NO_ERROR);
+
+    uint8_t value = 0;
+    {
+        // A crash at this point loses the pending writes, but not the last flushed value.
+        TestPersistentStorageDelegate storageAfterCrash = storage;
+        DefaultAttributePersistenceProvider restartedPersister;
+        ASSERT_EQ(restartedPersister.Init(&storageAfterCrash), CHIP_NO_ERROR);
+
+        EXPECT_EQ(ReadUint8(restartedPersister, kDeferredPath, value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, 5);
+    }
+
+    // Flushing on shutdown persists the last written value.
+    EXPECT_EQ(deferred.Flush(), CHIP_NO_ERROR);
+    {
+        TestPersistentStorageDelegate storageAfterShutdown = storage;
+        DefaultAttributePersistenceProvider restartedPersister;
+        ASSERT_EQ(restartedPersister.Init(&storageAfterShutdown), CHIP_NO_ERROR);
+
+        EXPECT_EQ(ReadUint8(restartedPersister, kDeferredPath, value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, 7);
+    }
+}
+
+} // namespace
@@ -98,6 +98,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestDirtyPathBatchNotifiesReadHandlerOnce();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -131,6 +132,17 @@ public:
     }
 };
 
+class CountingReadHandlerObserver : public ReadHandler::Observer
+{
+public:
+    void OnSubscriptionEstablished(ReadHandler * apReadHandler) override {}
+    void OnBecameReportable(ReadHandler * apReadHandler) override { mBecameReportableCount++; }
+    void OnSubscriptionReportSent(ReadHandler * apReadHandler) override {}
+    void OnReadHandlerDestroyed(ReadHandler * apReadHandler) override {}
+
+    uint32_t mBecameReportableCount = 0;
+};
+
 template <typename... Args>
 bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 {
@@ -352,6 +364,56 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtyPathBatchNotifiesReadHandlerOnce)
+{
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    Engine & reportingEngine          = imEngine->GetReportingEngine();
+    DummyDelegate dummy;
+    CountingReadHandlerObserver observer;
+    TestExchangeDelegate delegate;
+
+    EXPECT_EQ(imEngine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+    reportingEngine.mGlobalDirtySet.ReleaseAll();
+
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+    ReadHandler * readHandler                = imEngine->GetReadHandlerPool().CreateObject(
+        dummy, exchangeCtx, ReadHandler::InteractionType::Read, &observer, CodegenDataModelProviderInstance(nullptr));
+    ASSERT_NE(readHandler, nullptr);
+    AttributePathParams interestedPath(kTestEndpointId, kTestClusterId);
+    EXPECT_EQ(imEngine->PushFrontAttributePathList(readHandler->mpAttributePathList, interestedPath), CHIP_NO_ERROR);
+    readHandler->MoveToState(ReadHandler::HandlerState::CanStartReporting);
+    observer.mBecameReportableCount = 0;
+
+    // Outside of a batch, every dirty path notifies the observer.
+    EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1)), CHIP_NO_ERROR);
+    EXPECT_EQ(observer.mBecameReportableCount, 1u);
+
+    // Inside a (nested) batch, the observer is notified once, when the outermost batch ends.
+    observer.mBecameReportableCount = 0;
+    reportingEngine.BeginDirtyPathBatch();
+    reportingEngine.BeginDirtyPathBatch();
+    EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1)), CHIP_NO_ERROR);
+    EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2)), CHIP_NO_ERROR);
+    reportingEngine.EndDirtyPathBatch();
+    EXPECT_EQ(observer.mBecameReportableCount, 0u);
+    reportingEngine.EndDirtyPathBatch();
+    EXPECT_EQ(observer.mBecameReportableCount, 1u);
+    EXPECT_FALSE(reportingEngine.IsBatchingDirtyPaths());
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1),
+                                      AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2)));
+
+    // A batch that did not dirty anything the handler is interested in does not notify it.
+    observer.mBecameReportableCount = 0;
+    reportingEngine.BeginDirtyPathBatch();
+    EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(kTestEndpointId, kTestClusterId + 1, kTestFieldId1)), CHIP_NO_ERROR);
+    reportingEngine.EndDirtyPathBatch();
+    EXPECT_EQ(observer.mBecameReportableCount, 0u);
+
+    imEngine->GetReadHandlerPool().ReleaseAll();
+    reportingEngine.mGlobalDirtySet.ReleaseAll();
+    DrainAndServiceIO();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
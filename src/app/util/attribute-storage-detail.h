@@ -64,6 +64,10 @@ EmberAfGenericClusterFunction emberAfFindClusterFunction(const EmberAfCluster *
 void emAfSaveAttributeToStorageIfNeeded(uint8_t * data, chip::EndpointId endpoint, chip::ClusterId clusterId,
                                         const EmberAfAttributeMetadata * metadata);
 
+// Must be called when an attribute value in ember storage changes without emberAfAttributeChanged
+// being called for it (i.e. without the cluster data version changing).
+void emAfUnversionedAttributeChanged();
+
 // Calls the attribute changed callback
 void emAfClusterAttributeChangedCallback(const chip::app::ConcreteAttributePath & attributePath);
 
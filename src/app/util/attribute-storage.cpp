@@ -98,6 +98,10 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+/// Increased whenever an attribute value in ember storage changes without the
+/// data version of its cluster being increased (see emberAfUnversionedAttributeChangeGeneration)
+unsigned emberUnversionedAttributeChangeGeneration = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -960,6 +964,16 @@ unsigned emberAfMetadataStructureGeneration()
     return emberMetadataStructureGeneration;
 }
 
+void emAfUnversionedAttributeChanged()
+{
+    emberUnversionedAttributeChangeGeneration++;
+}
+
+unsigned emberAfUnversionedAttributeChangeGeneration()
+{
+    return emberUnversionedAttributeChangeGeneration;
+}
+
 // Returns the index of a given endpoint.  Does not consider disabled endpoints.
 uint16_t emberAfIndexFromEndpoint(EndpointId endpoint)
 {
@@ -1284,6 +1298,9 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, Optional<ClusterId> clusterI
             break;
         }
     }
+
+    // Loading defaults does not change any data versions
+    emAfUnversionedAttributeChanged();
 }
 
 // 'data' argument may be null, since we changed the ptrToDefaultValue
@@ -320,6 +320,14 @@ void emberAfEndpointChanged(chip::EndpointId endpoint, chip::app::AttributesChan
 /// are reflected in this generation count changing.
 unsigned emberAfMetadataStructureGeneration();
 
+/// Maintains an increasing index of attribute value changes within ember storage
+/// that did NOT increase the data version of the cluster (e.g. writes using
+/// MarkAttributeDirty::kNo or attribute defaults being loaded).
+///
+/// Anything that caches attribute values by data version must discard them when
+/// this generation count changes.
+unsigned emberAfUnversionedAttributeChangeGeneration();
+
 namespace chip {
 namespace app {
 
@@ -470,6 +470,10 @@ Status emAfWriteAttribute(const ConcreteAttributePath & path, const EmberAfWrite
     {
         emberAfAttributeChanged(path.mEndpointId, path.mClusterId, path.mAttributeId, input.changeListener);
     }
+    else
+    {
+        emAfUnversionedAttributeChanged();
+    }
 
     // Post write attribute callback for all attributes changes, regardless
     // of cluster.
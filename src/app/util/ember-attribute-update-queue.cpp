@@ -0,0 +1,58 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/util/ember-attribute-update-queue.h>
+
+#include <app/util/attribute-table.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+void DrainQueue(intptr_t context)
+{
+    reinterpret_cast<AttributeUpdateQueue *>(context)->Drain();
+}
+
+} // namespace
+
+CHIP_ERROR EmberAttributeUpdateQueueDelegate::ScheduleDrain(AttributeUpdateQueue & queue)
+{
+    return DeviceLayer::PlatformMgr().ScheduleWork(DrainQueue, reinterpret_cast<intptr_t>(&queue));
+}
+
+void EmberAttributeUpdateQueueDelegate::ApplyUpdate(const AttributeUpdateQueue::Update & update)
+{
+    // emberAfWriteAttribute does not take a const buffer
+    uint8_t value[AttributeUpdateQueue::kMaxValueSize];
+    memcpy(value, update.value, update.valueLength);
+
+    Protocols::InteractionModel::Status status = emberAfWriteAttribute(update.path, EmberAfWriteDataInput(value, update.type));
+    if (status != Protocols::InteractionModel::Status::Success)
+    {
+        ChipLogError(Zcl, "Failed to apply queued update of %u/" ChipLogFormatMEI "/" ChipLogFormatMEI ": 0x%02x",
+                     update.path.mEndpointId, ChipLogValueMEI(update.path.mClusterId), ChipLogValueMEI(update.path.mAttributeId),
+                     to_underlying(status));
+    }
+}
+
+} // namespace app
+} // namespace chip
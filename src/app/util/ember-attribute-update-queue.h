@@ -0,0 +1,46 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributeUpdateQueue.h>
+
+namespace chip {
+namespace app {
+
+/// Applies the updates of an AttributeUpdateQueue to the ember attribute storage, the same way
+/// the generated `Attributes::<Attribute>::Set` accessors do.
+///
+/// Drains are scheduled with `PlatformMgr().ScheduleWork`, so application threads can queue
+/// updates without locking the Matter stack:
+///
+///     EmberAttributeUpdateQueueDelegate gUpdateDelegate;
+///     AttributeUpdateQueueWithStorage<32> gUpdateQueue(gUpdateDelegate);
+///
+///     // On any thread, once gUpdateQueue.Init() was called:
+///     int16_t value = ...; // in attribute storage format
+///     gUpdateQueue.Enqueue(ConcreteAttributePath(endpoint, TemperatureMeasurement::Id,
+///                                                TemperatureMeasurement::Attributes::MeasuredValue::Id),
+///                          ZCL_INT16S_ATTRIBUTE_TYPE, ByteSpan(reinterpret_cast<const uint8_t *>(&value), sizeof(value)));
+class EmberAttributeUpdateQueueDelegate : public AttributeUpdateQueue::Delegate
+{
+public:
+    CHIP_ERROR ScheduleDrain(AttributeUpdateQueue & queue) override;
+    void ApplyUpdate(const AttributeUpdateQueue::Update & update) override;
+};
+
+} // namespace app
+} // namespace chip
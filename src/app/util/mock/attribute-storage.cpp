@@ -386,6 +386,12 @@ unsigned emberAfMetadataStructureGeneration()
     return metadataStructureGeneration;
 }
 
+unsigned emberAfUnversionedAttributeChangeGeneration()
+{
+    // Mock attribute values are not kept in ember storage
+    return 0;
+}
+
 namespace chip {
 namespace app {
 
@@ -35,11 +35,12 @@ CHIP_ERROR DeferredAttribute::PrepareWrite(System::Clock::Timestamp flushTime, c
     return CHIP_NO_ERROR;
 }
 
-void DeferredAttribute::Flush(AttributePersistenceProvider & persister)
+CHIP_ERROR DeferredAttribute::Flush(AttributePersistenceProvider & persister)
 {
-    VerifyOrReturn(IsArmed());
-    persister.WriteValue(mPath, ByteSpan(mValue.Get(), mValue.AllocatedSize()));
+    VerifyOrReturnError(IsArmed(), CHIP_NO_ERROR);
+    CHIP_ERROR err = persister.WriteValue(mPath, GetValue());
     mValue.Free();
+    return err;
 }
 
 CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue)
@@ -48,7 +49,12 @@ CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttrib
     {
         if (da.Matches(aPath))
         {
+            const bool absorbed = da.IsArmed();
             ReturnErrorOnFailure(da.PrepareWrite(System::SystemClock().GetMonotonicTimestamp() + mWriteDelay, aValue));
+            if (absorbed)
+            {
+                mAbsorbedWriteCount++;
+            }
             FlushAndScheduleNext();
             return CHIP_NO_ERROR;
         }
@@ -60,9 +66,45 @@ CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttrib
 CHIP_ERROR DeferredAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
                                                            const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
 {
+    for (DeferredAttribute & da : mDeferredAttributes)
+    {
+        if (da.Matches(aPath) && da.IsArmed())
+        {
+            return CopySpanToMutableSpan(da.GetValue(), aValue);
+        }
+    }
+
     return mPersister.ReadValue(aPath, aMetadata, aValue);
 }
 
+CHIP_ERROR DeferredAttributePersistenceProvider::Flush()
+{
+    DeviceLayer::SystemLayer().CancelTimer(OnFlushTimer, this);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (DeferredAttribute & da : mDeferredAttributes)
+    {
+        CHIP_ERROR flushErr = FlushAttribute(da);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = flushErr;
+        }
+    }
+    return err;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::FlushAttribute(DeferredAttribute & attribute)
+{
+    VerifyOrReturnError(attribute.IsArmed(), CHIP_NO_ERROR);
+    mFlushedWriteCount++;
+    return attribute.Flush(mPersister);
+}
+
+void DeferredAttributePersistenceProvider::OnFlushTimer(System::Layer *, void * me)
+{
+    static_cast<DeferredAttributePersistenceProvider *>(me)->FlushAndScheduleNext();
+}
+
 void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
 {
     const System::Clock::Timestamp now     = System::SystemClock().GetMonotonicTimestamp();
@@ -77,7 +119,7 @@ void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
 
         if (da.GetFlushTime() <= now)
         {
-            da.Flush(mPersister);
+            FlushAttribute(da);
         }
         else
         {
@@ -87,10 +129,7 @@ void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
 
     if (nextFlushTime != System::Clock::Timestamp::max())
     {
-        DeviceLayer::SystemLayer().StartTimer(
-            nextFlushTime - now,
-            [](System::Layer *, void * me) { static_cast<DeferredAttributePersistenceProvider *>(me)->FlushAndScheduleNext(); },
-            this);
+        DeviceLayer::SystemLayer().StartTimer(nextFlushTime - now, OnFlushTimer, this);
     }
 }
 
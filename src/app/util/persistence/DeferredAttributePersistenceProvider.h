@@ -19,6 +19,7 @@
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 #include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 
 namespace chip {
 namespace app {
@@ -31,9 +32,10 @@ public:
     bool Matches(const ConcreteAttributePath & path) const { return mPath == path; }
     bool IsArmed() const { return static_cast<bool>(mValue); }
     System::Clock::Timestamp GetFlushTime() const { return mFlushTime; }
+    ByteSpan GetValue() const { return ByteSpan(mValue.Get(), mValue.AllocatedSize()); }
 
     CHIP_ERROR PrepareWrite(System::Clock::Timestamp flushTime, const ByteSpan & value);
-    void Flush(AttributePersistenceProvider & persister);
+    CHIP_ERROR Flush(AttributePersistenceProvider & persister);
 
 private:
     const ConcreteAttributePath mPath;
@@ -48,6 +50,10 @@ private:
  * This class is useful to increase the flash lifetime by reducing the number
  * of writes of fast-changing attributes, such as CurrentLevel attribute of the
  * LevelControl cluster.
+ *
+ * Values that have not been written yet are lost if the device resets, so
+ * applications should call Flush() when shutting down, and from their
+ * power-fail handler if they have one.
  */
 class DeferredAttributePersistenceProvider : public AttributePersistenceProvider
 {
@@ -68,15 +74,37 @@ public:
      * For other attributes, immediately pass the write operation to the decorated persister.
      */
     CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const ByteSpan & aValue) override;
+
+    /*
+     * If a write of the attribute is pending, return the value it will write, so that
+     * reads are consistent with the last write.
+     */
     CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
                          MutableByteSpan & aValue) override;
 
+    /*
+     * Immediately pass all pending writes to the decorated persister, without waiting for
+     * the write delay to expire.
+     */
+    CHIP_ERROR Flush();
+
+    // Number of writes of deferred attributes that were superseded by a later write before being persisted.
+    uint32_t GetAbsorbedWriteCount() const { return mAbsorbedWriteCount; }
+
+    // Number of writes of deferred attributes that were passed to the decorated persister.
+    uint32_t GetFlushedWriteCount() const { return mFlushedWriteCount; }
+
 private:
+    static void OnFlushTimer(System::Layer *, void * me);
+
     void FlushAndScheduleNext();
+    CHIP_ERROR FlushAttribute(DeferredAttribute & attribute);
 
     AttributePersistenceProvider & mPersister;
     const Span<DeferredAttribute> mDeferredAttributes;
     const System::Clock::Milliseconds32 mWriteDelay;
+    uint32_t mAbsorbedWriteCount = 0;
+    uint32_t mFlushedWriteCount  = 0;
 };
 
 } // namespace app
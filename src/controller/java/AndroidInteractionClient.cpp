@@ -263,25 +263,26 @@ exit:
     return err;
 }
 
-// Convert Json to Tlv, and remove the outer structure
-CHIP_ERROR ConvertJsonToTlvWithoutStruct(const std::string & json, MutableByteSpan & data)
+// Convert Json to Tlv, and remove the outer structure. buf is allocated to hold the result, which data then points to.
+CHIP_ERROR ConvertJsonToTlvWithoutStruct(const std::string & json, Platform::ScopedMemoryBufferWithSize<uint8_t> & buf,
+                                         ByteSpan & data)
 {
-    Platform::ScopedMemoryBufferWithSize<uint8_t> buf;
-    VerifyOrReturnError(buf.Calloc(data.size()), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan dataWithStruct(buf.Get(), buf.AllocatedSize());
+    Platform::ScopedMemoryBufferWithSize<uint8_t> dataWithStruct;
     ReturnErrorOnFailure(JsonToTlv(json, dataWithStruct));
     TLV::TLVReader tlvReader;
     TLV::TLVType outerContainer = TLV::kTLVType_Structure;
-    tlvReader.Init(dataWithStruct);
+    tlvReader.Init(dataWithStruct.Get(), dataWithStruct.AllocatedSize());
     ReturnErrorOnFailure(tlvReader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
     ReturnErrorOnFailure(tlvReader.EnterContainer(outerContainer));
     ReturnErrorOnFailure(tlvReader.Next());
 
+    // The element is smaller than the structure it was encoded in
+    VerifyOrReturnError(buf.Alloc(dataWithStruct.AllocatedSize()), CHIP_ERROR_NO_MEMORY);
     TLV::TLVWriter tlvWrite;
-    tlvWrite.Init(data);
+    tlvWrite.Init(buf.Get(), buf.AllocatedSize());
     ReturnErrorOnFailure(tlvWrite.CopyElement(TLV::AnonymousTag(), tlvReader));
     ReturnErrorOnFailure(tlvWrite.Finalize());
-    data.reduce_size(tlvWrite.GetLengthWritten());
+    data = ByteSpan(buf.Get(), tlvWrite.GetLengthWritten());
     return CHIP_NO_ERROR;
 }
 
@@ -394,15 +395,11 @@ CHIP_ERROR write(JNIEnv * env, jlong handle, jlong callbackHandle, jlong deviceP
             JniUtfString jsonUtfJniString(env, jsonJniString);
             std::string jsonString = std::string(jsonUtfJniString.c_str(), static_cast<size_t>(jsonUtfJniString.size()));
 
-            // Context: Chunk write is supported in sdk, oversized list could be chunked in multiple message. When transforming
-            // JSON to TLV, we need know the actual size for tlv blob when handling JsonToTlv
-            // TODO: Implement memory auto-grow to get the actual size needed for tlv blob when transforming tlv to json.
-            // Workaround: Allocate memory using json string's size, which is large enough to hold the corresponding tlv blob
+            // Chunk write is supported in sdk, so an oversized list can be larger than a single message: the tlv blob is
+            // allocated to the size of its encoding.
             Platform::ScopedMemoryBufferWithSize<uint8_t> tlvBytes;
-            size_t length = static_cast<size_t>(jsonUtfJniString.size());
-            VerifyOrExit(tlvBytes.Calloc(length), err = CHIP_ERROR_NO_MEMORY);
-            MutableByteSpan data(tlvBytes.Get(), tlvBytes.AllocatedSize());
-            SuccessOrExit(err = ConvertJsonToTlvWithoutStruct(jsonString, data));
+            ByteSpan data;
+            SuccessOrExit(err = ConvertJsonToTlvWithoutStruct(jsonString, tlvBytes, data));
             SuccessOrExit(err = PutPreencodedWriteAttribute(*writeClient, path, data));
         }
     }
@@ -583,11 +580,10 @@ CHIP_ERROR extendableInvoke(JNIEnv * env, jlong handle, jlong callbackHandle, jl
                 VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
                 VerifyOrExit(jsonJniString != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
                 JniUtfString jsonUtfJniString(env, jsonJniString);
-                // The invoke does not support chunk, kMaxSecureSduLengthBytes should be enough for command json blob
-                uint8_t tlvBytes[chip::app::kMaxSecureSduLengthBytes] = { 0 };
-                MutableByteSpan tlvEncodingLocal{ tlvBytes };
+                Platform::ScopedMemoryBufferWithSize<uint8_t> tlvBytes;
                 SuccessOrExit(err = JsonToTlv(std::string(jsonUtfJniString.c_str(), static_cast<size_t>(jsonUtfJniString.size())),
-                                              tlvEncodingLocal));
+                                              tlvBytes));
+                ByteSpan tlvEncodingLocal(tlvBytes.Get(), tlvBytes.AllocatedSize());
                 SuccessOrExit(err = PutPreencodedInvokeRequest(*commandSender, path, tlvEncodingLocal, prepareCommandParams));
             }
         }
@@ -765,11 +761,10 @@ CHIP_ERROR invoke(JNIEnv * env, jlong handle, jlong callbackHandle, jlong device
             VerifyOrExit(!env->ExceptionCheck(), err = CHIP_JNI_ERROR_EXCEPTION_THROWN);
             VerifyOrExit(jsonJniString != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
             JniUtfString jsonUtfJniString(env, jsonJniString);
-            // The invoke does not support chunk, kMaxSecureSduLengthBytes should be enough for command json blob
-            uint8_t tlvBytes[chip::app::kMaxSecureSduLengthBytes] = { 0 };
-            MutableByteSpan tlvEncodingLocal{ tlvBytes };
+            Platform::ScopedMemoryBufferWithSize<uint8_t> tlvBytes;
             SuccessOrExit(err = JsonToTlv(std::string(jsonUtfJniString.c_str(), static_cast<size_t>(jsonUtfJniString.size())),
-                                          tlvEncodingLocal));
+                                          tlvBytes));
+            ByteSpan tlvEncodingLocal(tlvBytes.Get(), tlvBytes.AllocatedSize());
             SuccessOrExit(err = PutPreencodedInvokeRequest(*commandSender, path, tlvEncodingLocal));
         }
     }
@@ -29,6 +29,7 @@
 
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
+#include <credentials/CertificateSignatureCache.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
 #include <lib/core/CHIPCore.h>
@@ -411,6 +412,13 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    // Only CA certificates are shared between chains, so leaf certificates are not worth caching.
+    if (depth > 0 && context.mSignatureCache != nullptr)
+    {
+        ExitNow(err = context.mSignatureCache->VerifyCertSignature(*cert, *caCert));
+    }
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
     err = VerifyCertSignature(*cert, *caCert);
     SuccessOrExit(err);
 
@@ -502,6 +510,7 @@ void ValidationContext::Reset()
     mEffectiveTime  = EffectiveTime{};
     mTrustAnchor    = nullptr;
     mValidityPolicy = nullptr;
+    mSignatureCache = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
@@ -37,6 +37,8 @@
 namespace chip {
 namespace Credentials {
 
+class CertificateSignatureCache;
+
 struct CurrentChipEpochTime : chip::System::Clock::Seconds32
 {
     template <typename... Args>
@@ -74,6 +76,8 @@ struct ValidationContext
 
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
+    CertificateSignatureCache * mSignatureCache =
+        nullptr; /**< Optional cache of the CA certificate signatures that were already verified. */
 
     void Reset();
 
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/CertificateSignatureCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <mutex>
+#include <string.h>
+
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
+namespace chip {
+namespace Credentials {
+
+CHIP_ERROR CertificateSignatureCache::Init()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    if (!mLockInitialized)
+    {
+        ReturnErrorOnFailure(System::Mutex::Init(mLock));
+        mLockInitialized = true;
+    }
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    Clear();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CertificateSignatureCache::VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    Key key;
+    if (!cert.mCertFlags.Has(CertFlags::kTBSHashPresent) || ComputeKey(cert, signer, key) != CHIP_NO_ERROR)
+    {
+        return Credentials::VerifyCertSignature(cert, signer);
+    }
+
+    VerifyOrReturnError(!Lookup(key), CHIP_NO_ERROR);
+
+    // The lock is not held while verifying: concurrent misses for the same signature just both verify it.
+    ReturnErrorOnFailure(Credentials::VerifyCertSignature(cert, signer));
+    Add(key);
+    return CHIP_NO_ERROR;
+}
+
+void CertificateSignatureCache::Clear()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    mCount      = 0;
+    mUsageClock = 0;
+    mHitCount   = 0;
+    mMissCount  = 0;
+}
+
+CHIP_ERROR CertificateSignatureCache::ComputeKey(const ChipCertificateData & cert, const ChipCertificateData & signer, Key & key)
+{
+    // The signature itself is part of the key: a certificate with the same contents but a different
+    // signature has to be verified on its own.
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+
+    MutableByteSpan out(key);
+    return hash.Finish(out);
+}
+
+bool CertificateSignatureCache::Lookup(const Key & key)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+    for (size_t i = 0; i < mCount; ++i)
+    {
+        if (memcmp(mEntries[i].mKey, key, sizeof(Key)) == 0)
+        {
+            mEntries[i].mLastUsed = ++mUsageClock;
+            mHitCount++;
+            return true;
+        }
+    }
+    mMissCount++;
+    return false;
+}
+
+void CertificateSignatureCache::Add(const Key & key)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Entry * entry = nullptr;
+    for (size_t i = 0; i < mCount; ++i)
+    {
+        if (memcmp(mEntries[i].mKey, key, sizeof(Key)) == 0)
+        {
+            // Added by a concurrent miss.
+            entry = &mEntries[i];
+            break;
+        }
+    }
+
+    if (entry == nullptr && mCount < ArraySize(mEntries))
+    {
+        entry = &mEntries[mCount++];
+    }
+    else if (entry == nullptr)
+    {
+        // Replace the least recently used entry.
+        entry = &mEntries[0];
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.mLastUsed < entry->mLastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    memcpy(entry->mKey, key, sizeof(Key));
+    entry->mLastUsed = ++mUsageClock;
+}
+
+} // namespace Credentials
+} // namespace chip
+
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
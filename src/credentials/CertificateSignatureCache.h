@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a cache of certificate signatures that were already verified.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemMutex.h>
+
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Remembers which certificates were found to be correctly signed by which signer, so that a CA
+ * certificate presented over and over (e.g. the ICAC of every peer of a fabric) only has its
+ * signature verified once.
+ *
+ * Only the signature check is cached: it only depends on the certificate and the signer's public key.
+ * Everything else that certificate validation checks, including the validity period against the
+ * current or last known good time, is still checked every time.
+ *
+ * The cache may be used from the Matter thread and from background work at the same time.
+ */
+class CertificateSignatureCache
+{
+public:
+    CHIP_ERROR Init();
+
+    /**
+     * Same as the VerifyCertSignature() free function, except that a signature that was already
+     * verified successfully is not verified again.
+     */
+    CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    void Clear();
+
+    /// Number of signatures found in, or missing from, the cache since the last Clear().
+    size_t GetHitCount() const { return mHitCount; }
+    size_t GetMissCount() const { return mMissCount; }
+
+private:
+    using Key = uint8_t[Crypto::kSHA256_Hash_Length];
+
+    struct Entry
+    {
+        Key mKey;
+        uint32_t mLastUsed;
+    };
+
+    static CHIP_ERROR ComputeKey(const ChipCertificateData & cert, const ChipCertificateData & signer, Key & key);
+
+    bool Lookup(const Key & key);
+    void Add(const Key & key);
+
+    System::Mutex mLock;
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    bool mLockInitialized = false;
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    Entry mEntries[CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE];
+    size_t mCount        = 0;
+    uint32_t mUsageClock = 0;
+    size_t mHitCount     = 0;
+    size_t mMissCount    = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
+
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
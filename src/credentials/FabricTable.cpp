@@ -392,6 +392,12 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, const ByteSpa
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    if (context.mSignatureCache == nullptr)
+    {
+        context.mSignatureCache = GetCertificateSignatureCache();
+    }
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
     return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
                              outRootPublicKey);
 }
@@ -1097,6 +1103,10 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     // this condition and can act appropriately.
     mLastKnownGoodTime.Init(mStorage);
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    ReturnErrorOnFailure(mSignatureCache.Init());
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
     uint8_t buf[IndexInfoTLVMaxSize()];
     uint16_t size  = sizeof(buf);
     CHIP_ERROR err = mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::FabricIndexInfo().KeyName(), buf, size);
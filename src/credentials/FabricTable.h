@@ -26,6 +26,7 @@
 #include <app/util/basic-types.h>
 #include <credentials/CHIPCert.h>
 #include <credentials/CHIPCertificateSet.h>
+#include <credentials/CertificateSignatureCache.h>
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
@@ -958,7 +959,8 @@ public:
      */
     void RevertPendingOpCertsExceptRoot();
 
-    // Verifies credentials, using the root certificate of the provided fabric index.
+    // Verifies credentials, using the root certificate of the provided fabric index.  Unless the context already
+    // has one, the signature cache of the fabric table is used.
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
                                  Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                  FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
@@ -969,6 +971,17 @@ public:
                                         Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                         FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
                                         Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    // Cache of the CA certificate signatures already verified, to use in the context given to the static
+    // VerifyCredentials().  nullptr if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE is 0.
+    Credentials::CertificateSignatureCache * GetCertificateSignatureCache() const
+    {
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+        return &mSignatureCache;
+#else
+        return nullptr;
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    }
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1219,6 +1232,10 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+    mutable Credentials::CertificateSignatureCache mSignatureCache;
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -24,6 +24,8 @@
 #include <lib/support/Pool.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -663,23 +665,6 @@ struct KeySetData : PersistentData<kPersistentBufferMax>
         next = kInvalidKeysetId;
     }
 
-    Crypto::GroupOperationalCredentials * GetCurrentGroupCredentials()
-    {
-        // An epoch key update SHALL order the keys from oldest to newest,
-        // the current epoch key having the second newest time if time
-        // synchronization is not achieved or guaranteed.
-        switch (this->keys_count)
-        {
-        case 1:
-        case 2:
-            return &operational_keys[0];
-        case 3:
-            return &operational_keys[1];
-        default:
-            return nullptr;
-        }
-    }
-
     CHIP_ERROR Serialize(TLV::TLVWriter & writer) const override
     {
         TLV::TLVType container;
@@ -832,12 +817,16 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
+    FlushKeySetCache();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionIndex();
+    FlushKeySetCache();
 }
 
 //
@@ -1349,6 +1338,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1405,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1438,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1515,8 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    FlushKeySetCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1588,8 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
+    FlushKeySetCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1691,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionIndex();
+    FlushKeySetCache();
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1743,6 +1741,30 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 
 Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex fabric_index, GroupId group_id)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (UpdateGroupSessionIndex())
+    {
+        // Every mapping to a keyset with keys is in the index: use the first one of the group, as below.
+        const GroupSessionIndexEntry * first = nullptr;
+        for (size_t i = 0; i < mGroupSessionIndexCount; ++i)
+        {
+            const GroupSessionIndexEntry & entry = mGroupSessionIndex[i];
+            if (entry.fabric_index == fabric_index && entry.group_id == group_id && entry.keyset_id > 0 &&
+                (first == nullptr || entry.map_position < first->map_position))
+            {
+                first = &entry;
+            }
+        }
+        VerifyOrReturnValue(first != nullptr, nullptr);
+
+        KeySetCredentials keyset;
+        VerifyOrReturnValue(CHIP_NO_ERROR == LoadKeySetCredentials(fabric_index, first->keyset_id, keyset), nullptr);
+        const Crypto::GroupOperationalCredentials * creds = keyset.GetCurrentGroupCredentials();
+        VerifyOrReturnValue(creds != nullptr, nullptr);
+        return mGroupKeyContexPool.CreateObject(*this, creds->encryption_key, creds->hash, creds->privacy_key);
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), nullptr);
 
@@ -1757,9 +1779,9 @@ Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex f
         if (mapping.keyset_id > 0 && mapping.group_id == group_id)
         {
             // Group found, get the keyset
-            KeySetData keyset;
-            VerifyOrReturnError(keyset.Find(mStorage, fabric, mapping.keyset_id), nullptr);
-            Crypto::GroupOperationalCredentials * creds = keyset.GetCurrentGroupCredentials();
+            KeySetCredentials keyset;
+            VerifyOrReturnError(CHIP_NO_ERROR == LoadKeySetCredentials(fabric.fabric_index, mapping.keyset_id, keyset), nullptr);
+            const Crypto::GroupOperationalCredentials * creds = keyset.GetCurrentGroupCredentials();
             if (nullptr != creds)
             {
                 return mGroupKeyContexPool.CreateObject(*this, creds->encryption_key, creds->hash, creds->privacy_key);
@@ -1769,6 +1791,57 @@ Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex f
     return nullptr;
 }
 
+CHIP_ERROR GroupDataProviderImpl::LoadKeySetCredentials(FabricIndex fabric_index, KeysetId keyset_id,
+                                                        KeySetCredentials & credentials)
+{
+#if CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+    KeySetCacheEntry * victim = &mKeySetCache[0];
+    for (auto & entry : mKeySetCache)
+    {
+        if (entry.credentials.fabric_index == fabric_index && entry.credentials.keyset_id == keyset_id)
+        {
+            entry.last_used = ++mKeySetCacheClock;
+            credentials     = entry.credentials;
+            return CHIP_NO_ERROR;
+        }
+        if (entry.last_used < victim->last_used)
+        {
+            victim = &entry;
+        }
+    }
+#endif // CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+
+    KeySetData keyset(fabric_index, keyset_id);
+    ReturnErrorOnFailure(keyset.Load(mStorage));
+
+    credentials.fabric_index = fabric_index;
+    credentials.keyset_id    = keyset_id;
+    credentials.policy       = keyset.policy;
+    credentials.keys_count   = keyset.keys_count;
+    memcpy(credentials.operational_keys, keyset.operational_keys, sizeof(credentials.operational_keys));
+
+#if CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+    victim->credentials = credentials;
+    victim->last_used   = ++mKeySetCacheClock;
+#endif // CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::FlushKeySetCache()
+{
+#if CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+    for (auto & entry : mKeySetCache)
+    {
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(entry.credentials.operational_keys),
+                                sizeof(entry.credentials.operational_keys));
+        entry.credentials.fabric_index = kUndefinedFabricIndex;
+        entry.credentials.keyset_id    = kInvalidKeysetId;
+        entry.last_used                = 0;
+    }
+    mKeySetCacheClock = 0;
+#endif // CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+}
+
 CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset)
 {
     FabricData fabric(fabric_index);
@@ -1839,12 +1912,94 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    UpdateGroupSessionIndex();
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+bool GroupDataProviderImpl::UpdateGroupSessionIndex()
+{
+    if (mGroupSessionIndexStale)
+    {
+        // Live iterators refer to the entries of the current index by position.
+        VerifyOrReturnValue(mGroupSessionsIterator.Allocated() == 0, false);
+
+        // If the index does not fit, it is not attempted again until something changes.
+        mGroupSessionIndexComplete = BuildGroupSessionIndex();
+        mGroupSessionIndexStale    = false;
+    }
+    return mGroupSessionIndexComplete;
+}
+
+bool GroupDataProviderImpl::BuildGroupSessionIndex()
+{
+    mGroupSessionIndexCount = 0;
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, true);
+    VerifyOrReturnValue(CHIP_NO_ERROR == err, false);
+
+    auto sessionIdBefore = [](uint16_t id, const GroupSessionIndexEntry & entry) { return id < entry.session_id; };
+
+    // Same walk as GroupSessionIteratorImpl::Count(): anything it would stop at makes the index unusable.
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        VerifyOrReturnValue(CHIP_NO_ERROR == fabric.Load(mStorage), false);
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            VerifyOrReturnValue(CHIP_NO_ERROR == mapping.Load(mStorage), false);
+
+            KeySetData keyset;
+            VerifyOrReturnValue(keyset.Find(mStorage, fabric, mapping.keyset_id), false);
+
+            for (uint8_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                VerifyOrReturnValue(mGroupSessionIndexCount < CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE, false);
+
+                // Insert after the entries with the same session id, so that candidates come in storage order.
+                const uint16_t session_id         = keyset.operational_keys[k].hash;
+                GroupSessionIndexEntry * end      = mGroupSessionIndex + mGroupSessionIndexCount;
+                GroupSessionIndexEntry * position = std::upper_bound(mGroupSessionIndex, end, session_id, sessionIdBefore);
+                std::move_backward(position, end, end + 1);
+                *position = { session_id, mapping.group_id, mapping.keyset_id, fabric.fabric_index, k, j };
+                mGroupSessionIndexCount++;
+            }
+        }
+    }
+
+    return true;
+}
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (!provider.mGroupSessionIndexStale && provider.mGroupSessionIndexComplete)
+    {
+        const GroupSessionIndexEntry * begin = provider.mGroupSessionIndex;
+        const GroupSessionIndexEntry * end   = begin + provider.mGroupSessionIndexCount;
+        const GroupSessionIndexEntry * first =
+            std::lower_bound(begin, end, session_id,
+                             [](const GroupSessionIndexEntry & entry, uint16_t id) { return entry.session_id < id; });
+        const GroupSessionIndexEntry * last =
+            std::upper_bound(first, end, session_id,
+                             [](uint16_t id, const GroupSessionIndexEntry & entry) { return id < entry.session_id; });
+
+        mIndexed    = true;
+        mIndexBegin = static_cast<size_t>(first - begin);
+        mIndexNext  = mIndexBegin;
+        mIndexEnd   = static_cast<size_t>(last - begin);
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +2012,10 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    VerifyOrReturnValue(!mIndexed, mIndexEnd - mIndexBegin);
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +2057,10 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    VerifyOrReturnValue(!mIndexed, NextIndexed(output));
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1923,8 +2086,9 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
         VerifyOrReturnError(CHIP_NO_ERROR == mapping.Load(mProvider.mStorage), false);
 
         // Group found, get the keyset
-        KeySetData keyset;
-        VerifyOrReturnError(keyset.Find(mProvider.mStorage, fabric, mapping.keyset_id), false);
+        KeySetCredentials keyset;
+        VerifyOrReturnError(CHIP_NO_ERROR == mProvider.LoadKeySetCredentials(fabric.fabric_index, mapping.keyset_id, keyset),
+                            false);
 
         if (mKeyIndex >= keyset.keys_count)
         {
@@ -1935,7 +2099,7 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
             continue;
         }
 
-        Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[mKeyIndex++];
+        const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[mKeyIndex++];
         if (creds.hash == mSessionId)
         {
             mGroupKeyContext.Initialize(creds.encryption_key, mSessionId, creds.privacy_key);
@@ -1950,6 +2114,40 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
     return false;
 }
 
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+bool GroupDataProviderImpl::GroupSessionIteratorImpl::NextIndexed(GroupSession & output)
+{
+    while (mIndexNext < mIndexEnd)
+    {
+        const GroupSessionIndexEntry & entry = mProvider.mGroupSessionIndex[mIndexNext++];
+
+        // Only the keyset of the candidate has to be loaded, rather than every mapping of every fabric.
+        KeySetCredentials keyset;
+        if (CHIP_NO_ERROR != mProvider.LoadKeySetCredentials(entry.fabric_index, entry.keyset_id, keyset) ||
+            entry.key_index >= keyset.keys_count)
+        {
+            continue;
+        }
+
+        const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[entry.key_index];
+        if (creds.hash != mSessionId)
+        {
+            // The keyset changed since the iteration started.
+            continue;
+        }
+
+        mGroupKeyContext.Initialize(creds.encryption_key, mSessionId, creds.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = keyset.policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+
+    return false;
+}
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
 void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
 {
     mGroupKeyContext.ReleaseKeys();
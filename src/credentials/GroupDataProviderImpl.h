@@ -230,6 +230,10 @@ protected:
         void Release() override;
 
     protected:
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+        bool NextIndexed(GroupSession & output);
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
         GroupDataProviderImpl & mProvider;
         uint16_t mSessionId      = 0;
         FabricIndex mFirstFabric = kUndefinedFabricIndex;
@@ -241,11 +245,86 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+        bool mIndexed      = false;
+        size_t mIndexBegin = 0;
+        size_t mIndexNext  = 0;
+        size_t mIndexEnd   = 0;
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
         GroupKeyContext mGroupKeyContext;
     };
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    // One epoch key of the keyset mapped to a group, sorted by the session id derived from that key.
+    struct GroupSessionIndexEntry
+    {
+        uint16_t session_id;
+        GroupId group_id;
+        KeysetId keyset_id;
+        FabricIndex fabric_index;
+        uint8_t key_index;
+        uint16_t map_position;
+    };
+
+    // The index is built on demand, from the group key mappings and keysets in storage, and dropped
+    // whenever those change.  Returns whether the index can be used: it cannot if it does not fit, or
+    // while the previous index is still being iterated.
+    bool UpdateGroupSessionIndex();
+    bool BuildGroupSessionIndex();
+    void InvalidateGroupSessionIndex() { mGroupSessionIndexStale = true; }
+
+    GroupSessionIndexEntry mGroupSessionIndex[CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE];
+    size_t mGroupSessionIndexCount  = 0;
+    bool mGroupSessionIndexStale    = true;
+    bool mGroupSessionIndexComplete = false;
+#else
+    void InvalidateGroupSessionIndex() {}
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
+    // The operational credentials of a keyset, including the privacy keys derived from its epoch keys on load.
+    struct KeySetCredentials
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        KeysetId keyset_id       = kInvalidKeysetId;
+        SecurityPolicy policy    = SecurityPolicy::kCacheAndSync;
+        uint8_t keys_count       = 0;
+        Crypto::GroupOperationalCredentials operational_keys[KeySet::kEpochKeysMax];
+
+        const Crypto::GroupOperationalCredentials * GetCurrentGroupCredentials() const
+        {
+            // An epoch key update SHALL order the keys from oldest to newest,
+            // the current epoch key having the second newest time if time
+            // synchronization is not achieved or guaranteed.
+            switch (keys_count)
+            {
+            case 1:
+            case 2:
+                return &operational_keys[0];
+            case 3:
+                return &operational_keys[1];
+            default:
+                return nullptr;
+            }
+        }
+    };
+
+    // Loads the credentials of a keyset, from the keyset cache if possible.
+    CHIP_ERROR LoadKeySetCredentials(FabricIndex fabric_index, KeysetId keyset_id, KeySetCredentials & credentials);
+    void FlushKeySetCache();
+
+#if CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+    struct KeySetCacheEntry
+    {
+        KeySetCredentials credentials;
+        uint32_t last_used = 0;
+    };
+
+    KeySetCacheEntry mKeySetCache[CHIP_CONFIG_GROUP_KEY_CACHE_SIZE];
+    uint32_t mKeySetCacheClock = 0;
+#endif // CHIP_CONFIG_GROUP_KEY_CACHE_SIZE > 0
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
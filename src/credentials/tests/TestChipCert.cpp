@@ -27,6 +27,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/CertificateSignatureCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -833,6 +834,60 @@ TEST_F(TestChipCert, TestChipCert_CertValidTime)
     certSet.Release();
 }
 
+#if CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+TEST_F(TestChipCert, TestChipCert_CertSignatureCache)
+{
+    ChipCertificateSet certSet;
+    ValidationContext validContext;
+    CertificateSignatureCache cache;
+
+    EXPECT_EQ(cache.Init(), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestCertSet01(certSet), CHIP_NO_ERROR);
+
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    validContext.mSignatureCache = &cache;
+
+    // The ICAC signature is verified on the first validation, and found in the cache on the second one.
+    EXPECT_EQ(SetCurrentTime(validContext, 2022, 02, 23, 12, 30, 01), CHIP_NO_ERROR);
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetMissCount(), 1u);
+    EXPECT_EQ(cache.GetHitCount(), 0u);
+
+    EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetMissCount(), 1u);
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+
+    // The validity period is checked every time, whether the ICAC signature was verified before or not.
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ(SetCurrentTime(validContext, 2022, 02, 23, 12, 30, 01), CHIP_NO_ERROR);
+        EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+
+        EXPECT_EQ(SetCurrentTime(validContext, 2040, 10, 15, 14, 23, 43), CHIP_NO_ERROR);
+        EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_ERROR_CERT_EXPIRED);
+    }
+
+    const ChipCertificateData & rootCert = certSet.GetCertSet()[0];
+    const ChipCertificateData & icaCert  = certSet.GetCertSet()[1];
+    EXPECT_EQ(cache.VerifyCertSignature(icaCert, rootCert), CHIP_NO_ERROR);
+
+    // A certificate with the same contents but a different signature is not covered by the cached result.
+    uint8_t signature[kP256_ECDSA_Signature_Length_Raw];
+    memcpy(signature, icaCert.mSignature.data(), sizeof(signature));
+    signature[sizeof(signature) / 2] ^= 0x01;
+
+    ChipCertificateData tamperedCert = icaCert;
+    tamperedCert.mSignature          = P256ECDSASignatureSpan(signature);
+    EXPECT_NE(cache.VerifyCertSignature(tamperedCert, rootCert), CHIP_NO_ERROR);
+
+    // Nor is the same certificate checked against another signer.
+    EXPECT_NE(cache.VerifyCertSignature(icaCert, icaCert), CHIP_NO_ERROR);
+}
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE > 0
+
 TEST_F(TestChipCert, TestChipCert_ValidateChipRCAC)
 {
     struct RCACTestCase
@@ -1222,6 +1222,99 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionsAfterUpdate)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetGroupInfoAt(kFabric2, 0, kGroupInfo2_2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    auto countSessions = [&]() {
+        GroupSession session;
+        size_t count = 0;
+        auto it      = provider->IterateGroupSessions(session_id);
+        if (it == nullptr)
+        {
+            return count;
+        }
+        const size_t total = it->Count();
+        while (it->Next(session))
+        {
+            EXPECT_EQ(session.fabric_index, kFabric2);
+            EXPECT_EQ(session.group_id, kGroup2);
+            count++;
+        }
+        EXPECT_EQ(count, total);
+        it->Release();
+        return count;
+    };
+
+    // Sessions must reflect changes to the mappings and key sets made between lookups.
+    EXPECT_EQ(countSessions(), 1u);
+    EXPECT_EQ(provider->RemoveGroupKeys(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 0u);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 1u);
+    EXPECT_EQ(provider->RemoveKeySet(kFabric2, kKeySet1.keyset_id), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 0u);
+}
+
+TEST_F(TestGroupDataProvider, TestKeyContextAfterKeySetUpdate)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetGroupInfoAt(kFabric2, 0, kGroupInfo2_2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t old_session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    // Same keyset id, different epoch keys: the keys used for the group must follow.
+    KeySet updated(kKeySet1.keyset_id, kKeySet1.policy, kKeySet3.num_keys_used);
+    memcpy(updated.epoch_keys, kKeySet3.epoch_keys, sizeof(updated.epoch_keys));
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, updated), CHIP_NO_ERROR);
+
+    key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t new_session_id = key_context->GetKeyHash();
+    key_context->Release();
+    EXPECT_NE(old_session_id, new_session_id);
+
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(old_session_id);
+    ASSERT_TRUE(it);
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+
+    it = provider->IterateGroupSessions(new_session_id);
+    ASSERT_TRUE(it);
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_EQ(session.fabric_index, kFabric2);
+    EXPECT_EQ(session.group_id, kGroup2);
+    it->Release();
+
+    // Once the keyset is gone, there is no key for the group.
+    EXPECT_EQ(provider->RemoveKeySet(kFabric2, kKeySet1.keyset_id), CHIP_NO_ERROR);
+    EXPECT_EQ(nullptr, provider->GetKeyContext(kFabric2, kGroup2));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
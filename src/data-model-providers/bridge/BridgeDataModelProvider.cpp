@@ -0,0 +1,867 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <data-model-providers/bridge/BridgeDataModelProvider.h>
+
+#include <access/AccessControl.h>
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/GlobalAttributes.h>
+#include <crypto/RandUtils.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+using Protocols::InteractionModel::Status;
+using namespace Clusters::Descriptor::Attributes;
+
+constexpr uint16_t kDescriptorClusterRevision = 2;
+
+DataModel::AttributeInfo ReadOnlyAttributeInfo(bool isList)
+{
+    DataModel::AttributeInfo info;
+    info.flags.Set(DataModel::AttributeQualityFlags::kListAttribute, isList);
+    info.readPrivilege = Access::Privilege::kView;
+    return info;
+}
+
+Span<const BridgedAttributeEntry> DescriptorAttributes()
+{
+    static const BridgedAttributeEntry kAttributes[] = {
+        { DeviceTypeList::Id, ReadOnlyAttributeInfo(/* isList = */ true) },
+        { ServerList::Id, ReadOnlyAttributeInfo(/* isList = */ true) },
+        { ClientList::Id, ReadOnlyAttributeInfo(/* isList = */ true) },
+        { PartsList::Id, ReadOnlyAttributeInfo(/* isList = */ true) },
+        { FeatureMap::Id, ReadOnlyAttributeInfo(/* isList = */ false) },
+        { ClusterRevision::Id, ReadOnlyAttributeInfo(/* isList = */ false) },
+    };
+    return Span<const BridgedAttributeEntry>(kAttributes);
+}
+
+const BridgedAttributeEntry * FindAttribute(Span<const BridgedAttributeEntry> attributes, AttributeId id)
+{
+    for (const auto & attribute : attributes)
+    {
+        if (attribute.attributeId == id)
+        {
+            return &attribute;
+        }
+    }
+    return nullptr;
+}
+
+const BridgedCommandEntry * FindCommand(Span<const BridgedCommandEntry> commands, CommandId id)
+{
+    for (const auto & command : commands)
+    {
+        if (command.commandId == id)
+        {
+            return &command;
+        }
+    }
+    return nullptr;
+}
+
+DataModel::EndpointEntry EndpointEntryFor(const detail::BridgedEndpointTable::Entry * endpoint)
+{
+    VerifyOrReturnValue(endpoint != nullptr, DataModel::EndpointEntry::kInvalid);
+    return DataModel::EndpointEntry{ endpoint->config.id,
+                                     DataModel::EndpointInfo(endpoint->config.parentId, endpoint->config.compositionPattern) };
+}
+
+} // namespace
+
+namespace detail {
+
+size_t BridgedEndpointTable::HomeSlot(EndpointId id) const
+{
+    // Multiplying by an odd constant keeps consecutive endpoint ids (the common case for
+    // bridges) in distinct slots while spreading them over the table.
+    return (static_cast<size_t>(id) * 0x9E3779B1u) & (mSlots.AllocatedSize() - 1);
+}
+
+BridgedEndpointTable::Entry * BridgedEndpointTable::Find(EndpointId id)
+{
+    VerifyOrReturnValue((mSlots.AllocatedSize() > 0) && (id != kInvalidEndpointId), nullptr);
+
+    const size_t mask = mSlots.AllocatedSize() - 1;
+    for (size_t index = HomeSlot(id);; index = (index + 1) & mask)
+    {
+        Entry & entry = mSlots[index];
+        if (entry.config.id == id)
+        {
+            return &entry;
+        }
+        if (entry.config.id == kInvalidEndpointId)
+        {
+            return nullptr;
+        }
+    }
+}
+
+CHIP_ERROR BridgedEndpointTable::Insert(const Entry & entry)
+{
+    VerifyOrReturnError(entry.config.id != kInvalidEndpointId, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Keep the load factor at 3/4 at most so that probe sequences stay short
+    if ((mCount + 1) * 4 > mSlots.AllocatedSize() * 3)
+    {
+        ReturnErrorOnFailure(Grow());
+    }
+
+    const size_t mask = mSlots.AllocatedSize() - 1;
+    size_t index      = HomeSlot(entry.config.id);
+    while (mSlots[index].config.id != kInvalidEndpointId)
+    {
+        index = (index + 1) & mask;
+    }
+    mSlots[index] = entry;
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+bool BridgedEndpointTable::Remove(EndpointId id)
+{
+    Entry * entry = Find(id);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    // Backward shift deletion: move the following entries of the probe sequence into the hole
+    // as long as that does not put them before their home slot, so that no tombstones are needed.
+    const size_t mask = mSlots.AllocatedSize() - 1;
+    size_t hole       = IndexOf(entry);
+    for (size_t index = (hole + 1) & mask; mSlots[index].config.id != kInvalidEndpointId; index = (index + 1) & mask)
+    {
+        const size_t home = HomeSlot(mSlots[index].config.id);
+        if (((index - home) & mask) >= ((index - hole) & mask))
+        {
+            mSlots[hole] = mSlots[index];
+            hole         = index;
+        }
+    }
+    mSlots[hole] = Entry();
+    mCount--;
+    return true;
+}
+
+BridgedEndpointTable::Entry * BridgedEndpointTable::FirstFrom(size_t index)
+{
+    for (; index < mSlots.AllocatedSize(); index++)
+    {
+        if (mSlots[index].config.id != kInvalidEndpointId)
+        {
+            return &mSlots[index];
+        }
+    }
+    return nullptr;
+}
+
+void BridgedEndpointTable::Clear()
+{
+    mSlots.Free();
+    mCount = 0;
+}
+
+CHIP_ERROR BridgedEndpointTable::Grow()
+{
+    constexpr size_t kInitialCapacity = 16;
+
+    const size_t capacity = (mSlots.AllocatedSize() == 0) ? kInitialCapacity : mSlots.AllocatedSize() * 2;
+    Platform::ScopedMemoryBufferWithSize<Entry> previousSlots(std::move(mSlots));
+
+    mSlots.Calloc(capacity);
+    if (mSlots.Get() == nullptr)
+    {
+        mSlots = std::move(previousSlots);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < previousSlots.AllocatedSize(); i++)
+    {
+        const Entry & entry = previousSlots[i];
+        if (entry.config.id == kInvalidEndpointId)
+        {
+            continue;
+        }
+
+        size_t index = HomeSlot(entry.config.id);
+        while (mSlots[index].config.id != kInvalidEndpointId)
+        {
+            index = (index + 1) & mask;
+        }
+        mSlots[index] = entry;
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace detail
+
+CHIP_ERROR BridgeDataModelProvider::AddEndpoint(const BridgedEndpointConfig & config)
+{
+    VerifyOrReturnError(config.id != kInvalidEndpointId, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((mEndpoints.Find(config.id) == nullptr) && !mStaticProvider.EndpointExists(config.id),
+                        CHIP_ERROR_ENDPOINT_EXISTS);
+    // Endpoints are only removed once they have no children, so an existing parent can never have the new endpoint as an
+    // ancestor: the parent chains stay free of loops.
+    VerifyOrReturnError((config.parentId == kInvalidEndpointId) || EndpointExists(config.parentId), CHIP_ERROR_INVALID_ARGUMENT);
+
+    BridgedEndpoint endpoint;
+    endpoint.config                = config;
+    endpoint.descriptorDataVersion = Crypto::GetRandU32();
+    ReturnErrorOnFailure(mEndpoints.Insert(endpoint));
+
+    BridgedEndpoint * parent = mEndpoints.Find(config.parentId);
+    if (parent != nullptr)
+    {
+        parent->childCount++;
+    }
+
+    MarkDirty(AttributePathParams(config.id));
+    ReportPartsListChanged(config.parentId);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BridgeDataModelProvider::RemoveEndpoint(EndpointId id)
+{
+    BridgedEndpoint * endpoint = mEndpoints.Find(id);
+    VerifyOrReturnError(endpoint != nullptr, CHIP_ERROR_NOT_FOUND);
+    VerifyOrReturnError(endpoint->childCount == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    const EndpointId parentId = endpoint->config.parentId;
+    VerifyOrDie(mEndpoints.Remove(id));
+
+    BridgedEndpoint * parent = mEndpoints.Find(parentId);
+    if (parent != nullptr)
+    {
+        parent->childCount--;
+    }
+
+    ReportPartsListChanged(parentId);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BridgeDataModelProvider::Startup(DataModel::InteractionModelContext context)
+{
+    ReturnErrorOnFailure(DataModel::Provider::Startup(context));
+    return mStaticProvider.Startup(context);
+}
+
+CHIP_ERROR BridgeDataModelProvider::Shutdown()
+{
+    return mStaticProvider.Shutdown();
+}
+
+DataModel::ActionReturnStatus BridgeDataModelProvider::ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                                     AttributeValueEncoder & encoder)
+{
+    BridgedEndpoint * endpoint = mEndpoints.Find(request.path.mEndpointId);
+    if (endpoint == nullptr)
+    {
+        return mStaticProvider.ReadAttribute(request, encoder);
+    }
+
+    auto cluster = FindCluster(*endpoint, request.path);
+    if (const Status * status = std::get_if<Status>(&cluster))
+    {
+        return *status;
+    }
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+
+    if (IsSupportedGlobalAttributeNotInMetadata(request.path.mAttributeId))
+    {
+        return EncodeGlobalAttribute(instance, request.path.mAttributeId, encoder);
+    }
+    VerifyOrReturnError(FindAttribute(AttributesOf(instance), request.path.mAttributeId) != nullptr, Status::UnsupportedAttribute);
+
+    if (instance == nullptr)
+    {
+        return ReadDescriptorAttribute(*endpoint, request.path.mAttributeId, encoder);
+    }
+    return instance->ReadAttribute(request, encoder);
+}
+
+DataModel::ActionReturnStatus BridgeDataModelProvider::WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                                      AttributeValueDecoder & decoder)
+{
+    BridgedEndpoint * endpoint = mEndpoints.Find(request.path.mEndpointId);
+    if (endpoint == nullptr)
+    {
+        return mStaticProvider.WriteAttribute(request, decoder);
+    }
+
+    auto cluster = FindCluster(*endpoint, request.path);
+    if (const Status * status = std::get_if<Status>(&cluster))
+    {
+        return *status;
+    }
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+
+    // Global attributes that are not in the metadata are read-only lists, and the Descriptor
+    // cluster has no writable attributes.
+    VerifyOrReturnError(!IsSupportedGlobalAttributeNotInMetadata(request.path.mAttributeId), Status::UnsupportedWrite);
+    const BridgedAttributeEntry * attribute = FindAttribute(AttributesOf(instance), request.path.mAttributeId);
+    VerifyOrReturnError(attribute != nullptr, Status::UnsupportedAttribute);
+    VerifyOrReturnError(instance != nullptr, Status::UnsupportedWrite);
+
+    // Internal is allowed to bypass ACL, timed writes and read-only checks.
+    if (!request.operationFlags.Has(DataModel::OperationFlags::kInternal))
+    {
+        VerifyOrReturnError(attribute->info.writePrivilege.has_value(), Status::UnsupportedWrite);
+
+        // For chunked list writes, ACL is not re-checked when the previous write succeeded for the same attribute
+        const bool checkAcl = !request.previousSuccessPath.has_value() ||
+            (static_cast<const ConcreteAttributePath &>(request.path) != *request.previousSuccessPath);
+        if (checkAcl)
+        {
+            VerifyOrReturnError(request.subjectDescriptor != nullptr, Status::UnsupportedAccess);
+
+            Access::RequestPath requestPath{ .cluster     = request.path.mClusterId,
+                                             .endpoint    = request.path.mEndpointId,
+                                             .requestType = Access::RequestType::kAttributeWriteRequest,
+                                             .entityId    = request.path.mAttributeId };
+            CHIP_ERROR err =
+                Access::GetAccessControl().Check(*request.subjectDescriptor, requestPath, *attribute->info.writePrivilege);
+            if (err != CHIP_NO_ERROR)
+            {
+                VerifyOrReturnValue(err != CHIP_ERROR_ACCESS_DENIED, Status::UnsupportedAccess);
+                VerifyOrReturnValue(err != CHIP_ERROR_ACCESS_RESTRICTED_BY_ARL, Status::AccessRestricted);
+                return err;
+            }
+        }
+
+        VerifyOrReturnError(!attribute->info.flags.Has(DataModel::AttributeQualityFlags::kTimed) ||
+                                request.writeFlags.Has(DataModel::WriteFlags::kTimed),
+                            Status::NeedsTimedInteraction);
+    }
+
+    if (request.path.mDataVersion.HasValue() && (request.path.mDataVersion.Value() != instance->GetDataVersion()))
+    {
+        ChipLogError(DataManagement, "Write Version mismatch for Endpoint 0x%x, Cluster " ChipLogFormatMEI,
+                     request.path.mEndpointId, ChipLogValueMEI(request.path.mClusterId));
+        return Status::DataVersionMismatch;
+    }
+
+    DataModel::ActionReturnStatus status = instance->WriteAttribute(request, decoder);
+    if (status.IsSuccess())
+    {
+        instance->IncreaseDataVersion();
+        MarkDirty(AttributePathParams(request.path.mEndpointId, request.path.mClusterId, request.path.mAttributeId));
+    }
+    return status;
+}
+
+std::optional<DataModel::ActionReturnStatus> BridgeDataModelProvider::Invoke(const DataModel::InvokeRequest & request,
+                                                                             TLV::TLVReader & input_arguments,
+                                                                             CommandHandler * handler)
+{
+    BridgedEndpoint * endpoint = mEndpoints.Find(request.path.mEndpointId);
+    if (endpoint == nullptr)
+    {
+        return mStaticProvider.Invoke(request, input_arguments, handler);
+    }
+
+    auto cluster = FindCluster(*endpoint, request.path);
+    if (const Status * status = std::get_if<Status>(&cluster))
+    {
+        return *status;
+    }
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, Status::UnsupportedCommand);
+    VerifyOrReturnValue(FindCommand(instance->GetAcceptedCommands(), request.path.mCommandId) != nullptr,
+                        Status::UnsupportedCommand);
+
+    return instance->Invoke(request, input_arguments, handler);
+}
+
+DataModel::EndpointEntry BridgeDataModelProvider::FirstEndpoint()
+{
+    DataModel::EndpointEntry entry = mStaticProvider.FirstEndpoint();
+    VerifyOrReturnValue(!entry.IsValid(), entry);
+    return EndpointEntryFor(mEndpoints.FirstFrom(0));
+}
+
+DataModel::EndpointEntry BridgeDataModelProvider::NextEndpoint(EndpointId before)
+{
+    // Static endpoints are listed first, followed by the bridged ones in table order
+    BridgedEndpoint * endpoint = mEndpoints.Find(before);
+    if (endpoint != nullptr)
+    {
+        return EndpointEntryFor(mEndpoints.FirstFrom(mEndpoints.IndexOf(endpoint) + 1));
+    }
+
+    VerifyOrReturnValue(mStaticProvider.EndpointExists(before), DataModel::EndpointEntry::kInvalid);
+    DataModel::EndpointEntry entry = mStaticProvider.NextEndpoint(before);
+    VerifyOrReturnValue(!entry.IsValid(), entry);
+    return EndpointEntryFor(mEndpoints.FirstFrom(0));
+}
+
+std::optional<DataModel::EndpointInfo> BridgeDataModelProvider::GetEndpointInfo(EndpointId endpoint)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(endpoint);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.GetEndpointInfo(endpoint));
+    return DataModel::EndpointInfo(bridgedEndpoint->config.parentId, bridgedEndpoint->config.compositionPattern);
+}
+
+bool BridgeDataModelProvider::EndpointExists(EndpointId endpoint)
+{
+    return (mEndpoints.Find(endpoint) != nullptr) || mStaticProvider.EndpointExists(endpoint);
+}
+
+std::optional<DataModel::DeviceTypeEntry> BridgeDataModelProvider::FirstDeviceType(EndpointId endpoint)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(endpoint);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.FirstDeviceType(endpoint));
+    VerifyOrReturnValue(!bridgedEndpoint->config.deviceTypes.empty(), std::nullopt);
+    return bridgedEndpoint->config.deviceTypes[0];
+}
+
+std::optional<DataModel::DeviceTypeEntry> BridgeDataModelProvider::NextDeviceType(EndpointId endpoint,
+                                                                                  const DataModel::DeviceTypeEntry & previous)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(endpoint);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.NextDeviceType(endpoint, previous));
+
+    Span<const DataModel::DeviceTypeEntry> deviceTypes = bridgedEndpoint->config.deviceTypes;
+    for (size_t i = 0; i + 1 < deviceTypes.size(); i++)
+    {
+        if (deviceTypes[i] == previous)
+        {
+            return deviceTypes[i + 1];
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<DataModel::Provider::SemanticTag> BridgeDataModelProvider::GetFirstSemanticTag(EndpointId endpoint)
+{
+    VerifyOrReturnValue(mEndpoints.Find(endpoint) == nullptr, std::nullopt);
+    return mStaticProvider.GetFirstSemanticTag(endpoint);
+}
+
+std::optional<DataModel::Provider::SemanticTag> BridgeDataModelProvider::GetNextSemanticTag(EndpointId endpoint,
+                                                                                            const SemanticTag & previous)
+{
+    VerifyOrReturnValue(mEndpoints.Find(endpoint) == nullptr, std::nullopt);
+    return mStaticProvider.GetNextSemanticTag(endpoint, previous);
+}
+
+DataModel::ClusterEntry BridgeDataModelProvider::FirstServerCluster(EndpointId endpoint)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(endpoint);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.FirstServerCluster(endpoint));
+    return ServerClusterEntryAt(*bridgedEndpoint, 0);
+}
+
+DataModel::ClusterEntry BridgeDataModelProvider::NextServerCluster(const ConcreteClusterPath & before)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(before.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.NextServerCluster(before));
+
+    std::optional<size_t> index = ServerClusterIndex(*bridgedEndpoint, before.mClusterId);
+    VerifyOrReturnValue(index.has_value(), DataModel::ClusterEntry::kInvalid);
+    return ServerClusterEntryAt(*bridgedEndpoint, *index + 1);
+}
+
+std::optional<DataModel::ClusterInfo> BridgeDataModelProvider::GetServerClusterInfo(const ConcreteClusterPath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.GetServerClusterInfo(path));
+
+    std::optional<size_t> index = ServerClusterIndex(*bridgedEndpoint, path.mClusterId);
+    VerifyOrReturnValue(index.has_value(), std::nullopt);
+    return ServerClusterEntryAt(*bridgedEndpoint, *index).info;
+}
+
+ConcreteClusterPath BridgeDataModelProvider::FirstClientCluster(EndpointId endpoint)
+{
+    // Bridged endpoints have no client clusters
+    VerifyOrReturnValue(mEndpoints.Find(endpoint) == nullptr, ConcreteClusterPath());
+    return mStaticProvider.FirstClientCluster(endpoint);
+}
+
+ConcreteClusterPath BridgeDataModelProvider::NextClientCluster(const ConcreteClusterPath & before)
+{
+    VerifyOrReturnValue(mEndpoints.Find(before.mEndpointId) == nullptr, ConcreteClusterPath());
+    return mStaticProvider.NextClientCluster(before);
+}
+
+DataModel::AttributeEntry BridgeDataModelProvider::FirstAttribute(const ConcreteClusterPath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.FirstAttribute(path));
+
+    auto cluster = FindCluster(*bridgedEndpoint, path);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), DataModel::AttributeEntry::kInvalid);
+
+    Span<const BridgedAttributeEntry> attributes = AttributesOf(std::get<BridgedCluster *>(cluster));
+    VerifyOrReturnValue(!attributes.empty(), DataModel::AttributeEntry::kInvalid);
+    return DataModel::AttributeEntry{ ConcreteAttributePath(path.mEndpointId, path.mClusterId, attributes[0].attributeId),
+                                      attributes[0].info };
+}
+
+DataModel::AttributeEntry BridgeDataModelProvider::NextAttribute(const ConcreteAttributePath & before)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(before.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.NextAttribute(before));
+
+    auto cluster = FindCluster(*bridgedEndpoint, before);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), DataModel::AttributeEntry::kInvalid);
+
+    Span<const BridgedAttributeEntry> attributes = AttributesOf(std::get<BridgedCluster *>(cluster));
+    for (size_t i = 0; i + 1 < attributes.size(); i++)
+    {
+        if (attributes[i].attributeId == before.mAttributeId)
+        {
+            return DataModel::AttributeEntry{
+                ConcreteAttributePath(before.mEndpointId, before.mClusterId, attributes[i + 1].attributeId), attributes[i + 1].info
+            };
+        }
+    }
+    return DataModel::AttributeEntry::kInvalid;
+}
+
+std::optional<DataModel::AttributeInfo> BridgeDataModelProvider::GetAttributeInfo(const ConcreteAttributePath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.GetAttributeInfo(path));
+
+    auto cluster = FindCluster(*bridgedEndpoint, path);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), std::nullopt);
+
+    const BridgedAttributeEntry * attribute = FindAttribute(AttributesOf(std::get<BridgedCluster *>(cluster)), path.mAttributeId);
+    VerifyOrReturnValue(attribute != nullptr, std::nullopt);
+    return attribute->info;
+}
+
+DataModel::CommandEntry BridgeDataModelProvider::FirstAcceptedCommand(const ConcreteClusterPath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.FirstAcceptedCommand(path));
+
+    auto cluster = FindCluster(*bridgedEndpoint, path);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), DataModel::CommandEntry::kInvalid);
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, DataModel::CommandEntry::kInvalid);
+
+    Span<const BridgedCommandEntry> commands = instance->GetAcceptedCommands();
+    VerifyOrReturnValue(!commands.empty(), DataModel::CommandEntry::kInvalid);
+    return DataModel::CommandEntry{ ConcreteCommandPath(path.mEndpointId, path.mClusterId, commands[0].commandId),
+                                    commands[0].info };
+}
+
+DataModel::CommandEntry BridgeDataModelProvider::NextAcceptedCommand(const ConcreteCommandPath & before)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(before.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.NextAcceptedCommand(before));
+
+    auto cluster = FindCluster(*bridgedEndpoint, before);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), DataModel::CommandEntry::kInvalid);
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, DataModel::CommandEntry::kInvalid);
+
+    Span<const BridgedCommandEntry> commands = instance->GetAcceptedCommands();
+    for (size_t i = 0; i + 1 < commands.size(); i++)
+    {
+        if (commands[i].commandId == before.mCommandId)
+        {
+            return DataModel::CommandEntry{ ConcreteCommandPath(before.mEndpointId, before.mClusterId, commands[i + 1].commandId),
+                                            commands[i + 1].info };
+        }
+    }
+    return DataModel::CommandEntry::kInvalid;
+}
+
+std::optional<DataModel::CommandInfo> BridgeDataModelProvider::GetAcceptedCommandInfo(const ConcreteCommandPath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.GetAcceptedCommandInfo(path));
+
+    auto cluster = FindCluster(*bridgedEndpoint, path);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), std::nullopt);
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, std::nullopt);
+
+    const BridgedCommandEntry * command = FindCommand(instance->GetAcceptedCommands(), path.mCommandId);
+    VerifyOrReturnValue(command != nullptr, std::nullopt);
+    return command->info;
+}
+
+ConcreteCommandPath BridgeDataModelProvider::FirstGeneratedCommand(const ConcreteClusterPath & path)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(path.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.FirstGeneratedCommand(path));
+
+    auto cluster = FindCluster(*bridgedEndpoint, path);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), ConcreteCommandPath());
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, ConcreteCommandPath());
+
+    Span<const CommandId> commands = instance->GetGeneratedCommands();
+    VerifyOrReturnValue(!commands.empty(), ConcreteCommandPath());
+    return ConcreteCommandPath(path.mEndpointId, path.mClusterId, commands[0]);
+}
+
+ConcreteCommandPath BridgeDataModelProvider::NextGeneratedCommand(const ConcreteCommandPath & before)
+{
+    BridgedEndpoint * bridgedEndpoint = mEndpoints.Find(before.mEndpointId);
+    VerifyOrReturnValue(bridgedEndpoint != nullptr, mStaticProvider.NextGeneratedCommand(before));
+
+    auto cluster = FindCluster(*bridgedEndpoint, before);
+    VerifyOrReturnValue(std::holds_alternative<BridgedCluster *>(cluster), ConcreteCommandPath());
+    BridgedCluster * instance = std::get<BridgedCluster *>(cluster);
+    VerifyOrReturnValue(instance != nullptr, ConcreteCommandPath());
+
+    Span<const CommandId> commands = instance->GetGeneratedCommands();
+    for (size_t i = 0; i + 1 < commands.size(); i++)
+    {
+        if (commands[i] == before.mCommandId)
+        {
+            return ConcreteCommandPath(before.mEndpointId, before.mClusterId, commands[i + 1]);
+        }
+    }
+    return ConcreteCommandPath();
+}
+
+void BridgeDataModelProvider::Temporary_ReportAttributeChanged(const AttributePathParams & path)
+{
+    // Paths with a wildcard endpoint are left to the static provider, which only knows about its own endpoints
+    BridgedEndpoint * endpoint = path.HasWildcardEndpointId() ? nullptr : mEndpoints.Find(path.mEndpointId);
+    if (endpoint == nullptr)
+    {
+        mStaticProvider.Temporary_ReportAttributeChanged(path);
+        return;
+    }
+
+    // Same as for the codegen provider: a wildcard cluster only marks the endpoint dirty, without changing data versions
+    if (!path.HasWildcardClusterId())
+    {
+        if (path.mClusterId == Clusters::Descriptor::Id)
+        {
+            endpoint->descriptorDataVersion++;
+        }
+        for (BridgedCluster * cluster : endpoint->config.clusters)
+        {
+            if (cluster->GetClusterId() == path.mClusterId)
+            {
+                cluster->IncreaseDataVersion();
+            }
+        }
+    }
+    MarkDirty(path);
+}
+
+std::optional<BridgedCluster *> BridgeDataModelProvider::ServerClusterAt(const BridgedEndpoint & endpoint, size_t index)
+{
+    VerifyOrReturnValue(index > 0, std::make_optional<BridgedCluster *>(nullptr));
+    VerifyOrReturnValue(index <= endpoint.config.clusters.size(), std::nullopt);
+    return endpoint.config.clusters[index - 1];
+}
+
+std::optional<size_t> BridgeDataModelProvider::ServerClusterIndex(const BridgedEndpoint & endpoint, ClusterId clusterId)
+{
+    VerifyOrReturnValue(clusterId != Clusters::Descriptor::Id, 0);
+    for (size_t i = 0; i < endpoint.config.clusters.size(); i++)
+    {
+        if (endpoint.config.clusters[i]->GetClusterId() == clusterId)
+        {
+            return i + 1;
+        }
+    }
+    return std::nullopt;
+}
+
+DataModel::ClusterEntry BridgeDataModelProvider::ServerClusterEntryAt(const BridgedEndpoint & endpoint, size_t index)
+{
+    std::optional<BridgedCluster *> cluster = ServerClusterAt(endpoint, index);
+    VerifyOrReturnValue(cluster.has_value(), DataModel::ClusterEntry::kInvalid);
+
+    if (*cluster == nullptr)
+    {
+        return DataModel::ClusterEntry{ ConcreteClusterPath(endpoint.config.id, Clusters::Descriptor::Id),
+                                        DataModel::ClusterInfo(endpoint.descriptorDataVersion) };
+    }
+    return DataModel::ClusterEntry{ ConcreteClusterPath(endpoint.config.id, (*cluster)->GetClusterId()),
+                                    DataModel::ClusterInfo((*cluster)->GetDataVersion()) };
+}
+
+Span<const BridgedAttributeEntry> BridgeDataModelProvider::AttributesOf(const BridgedCluster * cluster)
+{
+    VerifyOrReturnValue(cluster != nullptr, DescriptorAttributes());
+    return cluster->GetAttributes();
+}
+
+std::variant<BridgedCluster *, Status> BridgeDataModelProvider::FindCluster(BridgedEndpoint & endpoint,
+                                                                            const ConcreteClusterPath & path)
+{
+    std::optional<size_t> index = ServerClusterIndex(endpoint, path.mClusterId);
+    VerifyOrReturnValue(index.has_value(), Status::UnsupportedCluster);
+    return *ServerClusterAt(endpoint, *index);
+}
+
+DataModel::ActionReturnStatus BridgeDataModelProvider::ReadDescriptorAttribute(const BridgedEndpoint & endpoint,
+                                                                               AttributeId attributeId,
+                                                                               AttributeValueEncoder & encoder)
+{
+    switch (attributeId)
+    {
+    case DeviceTypeList::Id:
+        return encoder.EncodeList([&endpoint](const auto & listEncoder) -> CHIP_ERROR {
+            for (const auto & deviceType : endpoint.config.deviceTypes)
+            {
+                Clusters::Descriptor::Structs::DeviceTypeStruct::Type value;
+                value.deviceType = deviceType.deviceTypeId;
+                value.revision   = deviceType.deviceTypeRevision;
+                ReturnErrorOnFailure(listEncoder.Encode(value));
+            }
+            return CHIP_NO_ERROR;
+        });
+    case ServerList::Id:
+        return encoder.EncodeList([&endpoint](const auto & listEncoder) -> CHIP_ERROR {
+            ReturnErrorOnFailure(listEncoder.Encode(Clusters::Descriptor::Id));
+            for (const BridgedCluster * cluster : endpoint.config.clusters)
+            {
+                ReturnErrorOnFailure(listEncoder.Encode(cluster->GetClusterId()));
+            }
+            return CHIP_NO_ERROR;
+        });
+    case ClientList::Id:
+        return encoder.EncodeEmptyList();
+    case PartsList::Id:
+        return EncodePartsList(endpoint, encoder);
+    case FeatureMap::Id:
+        return encoder.Encode(static_cast<uint32_t>(0));
+    case ClusterRevision::Id:
+        return encoder.Encode(kDescriptorClusterRevision);
+    default:
+        return Status::UnsupportedAttribute;
+    }
+}
+
+CHIP_ERROR BridgeDataModelProvider::EncodePartsList(const BridgedEndpoint & endpoint, AttributeValueEncoder & encoder)
+{
+    // Only bridged endpoints can have a bridged endpoint as parent. Bridged devices are generally
+    // leaves, which keeps wildcard reads of many endpoints linear.
+    VerifyOrReturnValue(endpoint.childCount > 0, encoder.EncodeEmptyList());
+
+    const bool fullFamily = (endpoint.config.compositionPattern == DataModel::EndpointCompositionPattern::kFullFamily);
+    return encoder.EncodeList([this, &endpoint, fullFamily](const auto & listEncoder) -> CHIP_ERROR {
+        for (BridgedEndpoint * candidate = mEndpoints.FirstFrom(0); candidate != nullptr;
+             candidate                   = mEndpoints.FirstFrom(mEndpoints.IndexOf(candidate) + 1))
+        {
+            // Tree pattern lists the direct children only, full family lists all descendants
+            for (BridgedEndpoint * ancestor = mEndpoints.Find(candidate->config.parentId); ancestor != nullptr;
+                 ancestor                   = fullFamily ? mEndpoints.Find(ancestor->config.parentId) : nullptr)
+            {
+                if (ancestor->config.id == endpoint.config.id)
+                {
+                    ReturnErrorOnFailure(listEncoder.Encode(candidate->config.id));
+                    break;
+                }
+            }
+        }
+        return CHIP_NO_ERROR;
+    });
+}
+
+CHIP_ERROR BridgeDataModelProvider::EncodeGlobalAttribute(const BridgedCluster * cluster, AttributeId attributeId,
+                                                          AttributeValueEncoder & encoder)
+{
+    namespace Globals = Clusters::Globals::Attributes;
+
+    switch (attributeId)
+    {
+    case Globals::AttributeList::Id:
+        // Same ordering as for ember clusters: the global attributes not in the metadata are listed
+        // right before the first attribute with a larger id (generally FeatureMap)
+        return encoder.EncodeList([cluster](const auto & listEncoder) -> CHIP_ERROR {
+            constexpr AttributeId lastGlobalId = GlobalAttributesNotInMetadata[ArraySize(GlobalAttributesNotInMetadata) - 1];
+            bool addedGlobals                  = false;
+            for (const auto & attribute : AttributesOf(cluster))
+            {
+                if (!addedGlobals && (attribute.attributeId > lastGlobalId))
+                {
+                    for (const auto & globalId : GlobalAttributesNotInMetadata)
+                    {
+                        ReturnErrorOnFailure(listEncoder.Encode(globalId));
+                    }
+                    addedGlobals = true;
+                }
+                ReturnErrorOnFailure(listEncoder.Encode(attribute.attributeId));
+            }
+            if (!addedGlobals)
+            {
+                for (const auto & globalId : GlobalAttributesNotInMetadata)
+                {
+                    ReturnErrorOnFailure(listEncoder.Encode(globalId));
+                }
+            }
+            return CHIP_NO_ERROR;
+        });
+    case Globals::AcceptedCommandList::Id:
+        VerifyOrReturnValue(cluster != nullptr, encoder.EncodeEmptyList());
+        return encoder.EncodeList([cluster](const auto & listEncoder) -> CHIP_ERROR {
+            for (const auto & command : cluster->GetAcceptedCommands())
+            {
+                ReturnErrorOnFailure(listEncoder.Encode(command.commandId));
+            }
+            return CHIP_NO_ERROR;
+        });
+    case Globals::GeneratedCommandList::Id:
+        VerifyOrReturnValue(cluster != nullptr, encoder.EncodeEmptyList());
+        return encoder.EncodeList([cluster](const auto & listEncoder) -> CHIP_ERROR {
+            for (const auto & command : cluster->GetGeneratedCommands())
+            {
+                ReturnErrorOnFailure(listEncoder.Encode(command));
+            }
+            return CHIP_NO_ERROR;
+        });
+    default:
+        return CHIP_IM_GLOBAL_STATUS(UnsupportedAttribute);
+    }
+}
+
+void BridgeDataModelProvider::MarkDirty(const AttributePathParams & path)
+{
+    DataModel::ProviderChangeListener * listener = CurrentContext().dataModelChangeListener;
+    VerifyOrReturn(listener != nullptr);
+    listener->MarkDirty(path);
+}
+
+void BridgeDataModelProvider::ReportPartsListChanged(EndpointId parentId)
+{
+    // Like ember does for dynamic endpoints: every ancestor and the root endpoint list the changed endpoint
+    bool reportedRoot = false;
+    for (EndpointId endpoint = parentId; endpoint != kInvalidEndpointId;)
+    {
+        Temporary_ReportAttributeChanged(AttributePathParams(endpoint, Clusters::Descriptor::Id, PartsList::Id));
+        reportedRoot = reportedRoot || (endpoint == kRootEndpointId);
+
+        std::optional<DataModel::EndpointInfo> info = GetEndpointInfo(endpoint);
+        endpoint                                    = info.has_value() ? info->parentId : kInvalidEndpointId;
+    }
+
+    if (!reportedRoot)
+    {
+        Temporary_ReportAttributeChanged(AttributePathParams(kRootEndpointId, Clusters::Descriptor::Id, PartsList::Id));
+    }
+}
+
+} // namespace app
+} // namespace chip
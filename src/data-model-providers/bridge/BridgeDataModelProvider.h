@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/data-model-provider/Provider.h>
+
+#include <data-model-providers/bridge/BridgedCluster.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <variant>
+
+namespace chip {
+namespace app {
+
+/// Describes one bridged endpoint.
+///
+/// The device type and cluster arrays are owned by the caller and MUST remain valid
+/// until the endpoint is removed from the provider.
+struct BridgedEndpointConfig
+{
+    EndpointId id       = kInvalidEndpointId;
+    EndpointId parentId = kInvalidEndpointId; // generally the aggregator endpoint of the bridge
+    DataModel::EndpointCompositionPattern compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily;
+    Span<const DataModel::DeviceTypeEntry> deviceTypes;
+    Span<BridgedCluster * const> clusters;
+};
+
+namespace detail {
+
+/// Open addressing hash table of bridged endpoints, keyed by endpoint id.
+///
+/// Lookups, insertions and removals are O(1) on average. The table grows on the heap as
+/// needed, so there is no compile-time limit on the number of endpoints.
+class BridgedEndpointTable
+{
+public:
+    struct Entry
+    {
+        BridgedEndpointConfig config;          // config.id is kInvalidEndpointId for free slots
+        DataVersion descriptorDataVersion = 0; // the Descriptor cluster is provided by the table owner
+        size_t childCount                 = 0; // number of entries that have this one as parent
+    };
+
+    Entry * Find(EndpointId id);
+    CHIP_ERROR Insert(const Entry & entry);
+    bool Remove(EndpointId id);
+
+    /// Returns the first used slot at or after `index` (nullptr if there is none), which
+    /// allows iterating over all entries in slot order.
+    Entry * FirstFrom(size_t index);
+    size_t IndexOf(const Entry * entry) const { return static_cast<size_t>(entry - mSlots.Get()); }
+
+    size_t Count() const { return mCount; }
+    void Clear();
+
+private:
+    Platform::ScopedMemoryBufferWithSize<Entry> mSlots; // capacity is 0 or a power of 2
+    size_t mCount = 0;
+
+    size_t HomeSlot(EndpointId id) const;
+    CHIP_ERROR Grow();
+};
+
+} // namespace detail
+
+/// A data model provider for bridges whose bridged devices come and go at runtime.
+///
+/// The static part of the node (root endpoint, aggregator, ...) is served by another
+/// provider, generally the CodegenDataModelProvider. Bridged endpoints are added and
+/// removed at runtime and their clusters are `BridgedCluster` instances: no ember
+/// metadata or `CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT` slot is involved.
+///
+/// Every bridged endpoint implicitly has a Descriptor cluster that is generated from the
+/// endpoint configuration. Adding or removing an endpoint updates the PartsList of its
+/// ancestors and of the root endpoint.
+class BridgeDataModelProvider : public DataModel::Provider
+{
+public:
+    explicit BridgeDataModelProvider(DataModel::Provider & staticProvider) : mStaticProvider(staticProvider) {}
+
+    /// Adds a bridged endpoint.
+    ///
+    /// Returns CHIP_ERROR_ENDPOINT_EXISTS if the endpoint id is already in use by this or the
+    /// static provider and CHIP_ERROR_INVALID_ARGUMENT if the parent endpoint does not exist.
+    CHIP_ERROR AddEndpoint(const BridgedEndpointConfig & config);
+
+    /// Removes a bridged endpoint.
+    ///
+    /// Returns CHIP_ERROR_NOT_FOUND if there is no such bridged endpoint and
+    /// CHIP_ERROR_INCORRECT_STATE if bridged endpoints that have it as a parent are left:
+    /// those have to be removed first.
+    CHIP_ERROR RemoveEndpoint(EndpointId id);
+
+    size_t GetBridgedEndpointCount() const { return mEndpoints.Count(); }
+
+    /// Generic model implementations
+    CHIP_ERROR Startup(DataModel::InteractionModelContext context) override;
+    CHIP_ERROR Shutdown() override;
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override;
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override;
+    std::optional<DataModel::ActionReturnStatus> Invoke(const DataModel::InvokeRequest & request, TLV::TLVReader & input_arguments,
+                                                        CommandHandler * handler) override;
+
+    /// attribute tree iteration
+    DataModel::EndpointEntry FirstEndpoint() override;
+    DataModel::EndpointEntry NextEndpoint(EndpointId before) override;
+    std::optional<DataModel::EndpointInfo> GetEndpointInfo(EndpointId endpoint) override;
+    bool EndpointExists(EndpointId endpoint) override;
+
+    std::optional<DataModel::DeviceTypeEntry> FirstDeviceType(EndpointId endpoint) override;
+    std::optional<DataModel::DeviceTypeEntry> NextDeviceType(EndpointId endpoint,
+                                                             const DataModel::DeviceTypeEntry & previous) override;
+
+    std::optional<SemanticTag> GetFirstSemanticTag(EndpointId endpoint) override;
+    std::optional<SemanticTag> GetNextSemanticTag(EndpointId endpoint, const SemanticTag & previous) override;
+
+    DataModel::ClusterEntry FirstServerCluster(EndpointId endpoint) override;
+    DataModel::ClusterEntry NextServerCluster(const ConcreteClusterPath & before) override;
+    std::optional<DataModel::ClusterInfo> GetServerClusterInfo(const ConcreteClusterPath & path) override;
+
+    ConcreteClusterPath FirstClientCluster(EndpointId endpoint) override;
+    ConcreteClusterPath NextClientCluster(const ConcreteClusterPath & before) override;
+
+    DataModel::AttributeEntry FirstAttribute(const ConcreteClusterPath & cluster) override;
+    DataModel::AttributeEntry NextAttribute(const ConcreteAttributePath & before) override;
+    std::optional<DataModel::AttributeInfo> GetAttributeInfo(const ConcreteAttributePath & path) override;
+
+    DataModel::CommandEntry FirstAcceptedCommand(const ConcreteClusterPath & cluster) override;
+    DataModel::CommandEntry NextAcceptedCommand(const ConcreteCommandPath & before) override;
+    std::optional<DataModel::CommandInfo> GetAcceptedCommandInfo(const ConcreteCommandPath & path) override;
+
+    ConcreteCommandPath FirstGeneratedCommand(const ConcreteClusterPath & cluster) override;
+    ConcreteCommandPath NextGeneratedCommand(const ConcreteCommandPath & before) override;
+
+    void Temporary_ReportAttributeChanged(const AttributePathParams & path) override;
+
+private:
+    using BridgedEndpoint = detail::BridgedEndpointTable::Entry;
+
+    DataModel::Provider & mStaticProvider;
+    detail::BridgedEndpointTable mEndpoints;
+
+    /// Returns the cluster instance at `index` of the endpoint server cluster list, where
+    /// index 0 is the implicit Descriptor cluster (returned as nullptr).
+    static std::optional<BridgedCluster *> ServerClusterAt(const BridgedEndpoint & endpoint, size_t index);
+    static std::optional<size_t> ServerClusterIndex(const BridgedEndpoint & endpoint, ClusterId clusterId);
+    static DataModel::ClusterEntry ServerClusterEntryAt(const BridgedEndpoint & endpoint, size_t index);
+    static Span<const BridgedAttributeEntry> AttributesOf(const BridgedCluster * cluster);
+
+    /// Finds the cluster instance for `path` on a bridged endpoint, or the status to report if
+    /// the cluster does not exist. The Descriptor cluster is returned as nullptr.
+    static std::variant<BridgedCluster *, Protocols::InteractionModel::Status> FindCluster(BridgedEndpoint & endpoint,
+                                                                                           const ConcreteClusterPath & path);
+
+    DataModel::ActionReturnStatus ReadDescriptorAttribute(const BridgedEndpoint & endpoint, AttributeId attributeId,
+                                                          AttributeValueEncoder & encoder);
+    CHIP_ERROR EncodePartsList(const BridgedEndpoint & endpoint, AttributeValueEncoder & encoder);
+    static CHIP_ERROR EncodeGlobalAttribute(const BridgedCluster * cluster, AttributeId attributeId,
+                                            AttributeValueEncoder & encoder);
+
+    void MarkDirty(const AttributePathParams & path);
+    void ReportPartsListChanged(EndpointId parentId);
+};
+
+} // namespace app
+} // namespace chip
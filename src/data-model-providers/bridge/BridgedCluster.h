@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributeValueDecoder.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/CommandHandler.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/OperationTypes.h>
+#include <crypto/RandUtils.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/Span.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <optional>
+
+namespace chip {
+namespace app {
+
+/// Metadata of one attribute of a bridged cluster.
+struct BridgedAttributeEntry
+{
+    AttributeId attributeId;
+    DataModel::AttributeInfo info;
+};
+
+/// Metadata of one accepted command of a bridged cluster.
+struct BridgedCommandEntry
+{
+    CommandId commandId;
+    DataModel::CommandInfo info;
+};
+
+/// A server cluster instance on an endpoint of a `BridgeDataModelProvider`.
+///
+/// Bridges typically create one instance per cluster of every bridged device, owning (or
+/// fronting) the state of that device, instead of declaring ember attribute tables for it.
+///
+/// The data version of the cluster is kept by the instance. The provider increases it
+/// whenever a write succeeds or `Temporary_ReportAttributeChanged` is called for one of the
+/// attributes of the cluster.
+class BridgedCluster
+{
+public:
+    explicit BridgedCluster(ClusterId clusterId) : mClusterId(clusterId), mDataVersion(Crypto::GetRandU32()) {}
+    virtual ~BridgedCluster() = default;
+
+    ClusterId GetClusterId() const { return mClusterId; }
+    DataVersion GetDataVersion() const { return mDataVersion; }
+    void IncreaseDataVersion() { mDataVersion++; }
+
+    /// Attributes of the cluster, including FeatureMap and ClusterRevision but not the
+    /// global attributes listed in `GlobalAttributesNotInMetadata`, which the provider
+    /// encodes itself.
+    virtual Span<const BridgedAttributeEntry> GetAttributes() const = 0;
+    virtual Span<const BridgedCommandEntry> GetAcceptedCommands() const { return {}; }
+    virtual Span<const CommandId> GetGeneratedCommands() const { return {}; }
+
+    /// Called for attributes returned by GetAttributes() only. Access control has already
+    /// been checked by the caller.
+    virtual DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                        AttributeValueEncoder & encoder) = 0;
+
+    /// Called for writable attributes returned by GetAttributes() only, after access control,
+    /// timed interaction and data version checks.
+    virtual DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                         AttributeValueDecoder & decoder)
+    {
+        return Protocols::InteractionModel::Status::UnsupportedWrite;
+    }
+
+    /// Called for commands returned by GetAcceptedCommands() only. Follows the return value
+    /// conventions of `DataModel::Provider::Invoke`.
+    virtual std::optional<DataModel::ActionReturnStatus> Invoke(const DataModel::InvokeRequest & request,
+                                                                TLV::TLVReader & input_arguments, CommandHandler * handler)
+    {
+        return Protocols::InteractionModel::Status::UnsupportedCommand;
+    }
+
+private:
+    const ClusterId mClusterId;
+    DataVersion mDataVersion;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,503 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/data-model-provider/StringBuilderAdapters.h>
+#include <app/data-model-provider/tests/ReadTesting.h>
+#include <app/data-model-provider/tests/WriteTesting.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/DecodableList.h>
+#include <data-model-providers/bridge/BridgeDataModelProvider.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Testing;
+using namespace chip::app::Clusters;
+
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+constexpr EndpointId kAggregatorEndpoint = 1;
+constexpr EndpointId kFirstBridgedEndpoint = 2;
+
+constexpr DeviceTypeId kOnOffLightDeviceType = 0x0100;
+constexpr DeviceTypeId kBridgedNodeDeviceType = 0x0013;
+
+/// Static part of the node: the root endpoint and an aggregator, with no clusters
+class StaticProvider : public DataModel::Provider
+{
+public:
+    CHIP_ERROR Shutdown() override { return CHIP_NO_ERROR; }
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        return Status::UnsupportedEndpoint;
+    }
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override
+    {
+        return Status::UnsupportedEndpoint;
+    }
+    std::optional<DataModel::ActionReturnStatus> Invoke(const DataModel::InvokeRequest & request, TLV::TLVReader & input_arguments,
+                                                        CommandHandler * handler) override
+    {
+        return Status::UnsupportedEndpoint;
+    }
+
+    DataModel::EndpointEntry FirstEndpoint() override
+    {
+        return DataModel::EndpointEntry{ kRootEndpointId, DataModel::EndpointInfo(kInvalidEndpointId) };
+    }
+    DataModel::EndpointEntry NextEndpoint(EndpointId before) override
+    {
+        VerifyOrReturnValue(before == kRootEndpointId, DataModel::EndpointEntry::kInvalid);
+        return DataModel::EndpointEntry{ kAggregatorEndpoint, DataModel::EndpointInfo(kInvalidEndpointId) };
+    }
+    std::optional<DataModel::EndpointInfo> GetEndpointInfo(EndpointId id) override
+    {
+        VerifyOrReturnValue(EndpointExists(id), std::nullopt);
+        return DataModel::EndpointInfo(kInvalidEndpointId);
+    }
+    bool EndpointExists(EndpointId id) override { return (id == kRootEndpointId) || (id == kAggregatorEndpoint); }
+
+    std::optional<DataModel::DeviceTypeEntry> FirstDeviceType(EndpointId endpoint) override { return std::nullopt; }
+    std::optional<DataModel::DeviceTypeEntry> NextDeviceType(EndpointId endpoint,
+                                                             const DataModel::DeviceTypeEntry & previous) override
+    {
+        return std::nullopt;
+    }
+    std::optional<SemanticTag> GetFirstSemanticTag(EndpointId endpoint) override { return std::nullopt; }
+    std::optional<SemanticTag> GetNextSemanticTag(EndpointId endpoint, const SemanticTag & previous) override
+    {
+        return std::nullopt;
+    }
+
+    DataModel::ClusterEntry FirstServerCluster(EndpointId endpoint) override { return DataModel::ClusterEntry::kInvalid; }
+    DataModel::ClusterEntry NextServerCluster(const ConcreteClusterPath & before) override
+    {
+        return DataModel::ClusterEntry::kInvalid;
+    }
+    std::optional<DataModel::ClusterInfo> GetServerClusterInfo(const ConcreteClusterPath & path) override { return std::nullopt; }
+    ConcreteClusterPath FirstClientCluster(EndpointId endpoint) override { return ConcreteClusterPath(); }
+    ConcreteClusterPath NextClientCluster(const ConcreteClusterPath & before) override { return ConcreteClusterPath(); }
+
+    DataModel::AttributeEntry FirstAttribute(const ConcreteClusterPath & cluster) override
+    {
+        return DataModel::AttributeEntry::kInvalid;
+    }
+    DataModel::AttributeEntry NextAttribute(const ConcreteAttributePath & before) override
+    {
+        return DataModel::AttributeEntry::kInvalid;
+    }
+    std::optional<DataModel::AttributeInfo> GetAttributeInfo(const ConcreteAttributePath & path) override { return std::nullopt; }
+
+    DataModel::CommandEntry FirstAcceptedCommand(const ConcreteClusterPath & cluster) override
+    {
+        return DataModel::CommandEntry::kInvalid;
+    }
+    DataModel::CommandEntry NextAcceptedCommand(const ConcreteCommandPath & before) override
+    {
+        return DataModel::CommandEntry::kInvalid;
+    }
+    std::optional<DataModel::CommandInfo> GetAcceptedCommandInfo(const ConcreteCommandPath & path) override { return std::nullopt; }
+    ConcreteCommandPath FirstGeneratedCommand(const ConcreteClusterPath & cluster) override { return ConcreteCommandPath(); }
+    ConcreteCommandPath NextGeneratedCommand(const ConcreteCommandPath & before) override { return ConcreteCommandPath(); }
+
+    void Temporary_ReportAttributeChanged(const AttributePathParams & path) override { mReportedPaths.push_back(path); }
+
+    std::vector<AttributePathParams> mReportedPaths;
+};
+
+class TestChangeListener : public DataModel::ProviderChangeListener
+{
+public:
+    void MarkDirty(const AttributePathParams & path) override { mDirtyPaths.push_back(path); }
+
+    std::vector<AttributePathParams> mDirtyPaths;
+};
+
+/// A bridged light exposing a writable OnOff attribute and the Toggle command
+class BridgedOnOffCluster : public BridgedCluster
+{
+public:
+    BridgedOnOffCluster() : BridgedCluster(OnOff::Id) {}
+
+    Span<const BridgedAttributeEntry> GetAttributes() const override
+    {
+        static const BridgedAttributeEntry kAttributes[] = {
+            { OnOff::Attributes::OnOff::Id, WritableInfo() },
+            { OnOff::Attributes::FeatureMap::Id, ReadOnlyInfo() },
+            { OnOff::Attributes::ClusterRevision::Id, ReadOnlyInfo() },
+        };
+        return Span<const BridgedAttributeEntry>(kAttributes);
+    }
+
+    Span<const BridgedCommandEntry> GetAcceptedCommands() const override
+    {
+        static const BridgedCommandEntry kCommands[] = { { OnOff::Commands::Toggle::Id, DataModel::CommandInfo() } };
+        return Span<const BridgedCommandEntry>(kCommands);
+    }
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        switch (request.path.mAttributeId)
+        {
+        case OnOff::Attributes::OnOff::Id:
+            return encoder.Encode(mOn);
+        case OnOff::Attributes::FeatureMap::Id:
+            return encoder.Encode(static_cast<uint32_t>(0));
+        case OnOff::Attributes::ClusterRevision::Id:
+            return encoder.Encode(static_cast<uint16_t>(6));
+        default:
+            return Status::UnsupportedAttribute;
+        }
+    }
+
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override
+    {
+        return decoder.Decode(mOn);
+    }
+
+    bool mOn = false;
+
+private:
+    static DataModel::AttributeInfo ReadOnlyInfo()
+    {
+        DataModel::AttributeInfo info;
+        info.readPrivilege = Access::Privilege::kView;
+        return info;
+    }
+
+    static DataModel::AttributeInfo WritableInfo()
+    {
+        DataModel::AttributeInfo info = ReadOnlyInfo();
+        info.writePrivilege           = Access::Privilege::kOperate;
+        return info;
+    }
+};
+
+/// One bridged device: a light with its own cluster instance
+struct BridgedLight
+{
+    BridgedOnOffCluster onOff;
+    BridgedCluster * clusters[1] = { &onOff };
+    DataModel::DeviceTypeEntry deviceTypes[2] = { { kOnOffLightDeviceType, 3 }, { kBridgedNodeDeviceType, 2 } };
+
+    BridgedEndpointConfig Config(EndpointId id, EndpointId parentId = kAggregatorEndpoint)
+    {
+        BridgedEndpointConfig config;
+        config.id          = id;
+        config.parentId    = parentId;
+        config.deviceTypes = Span<const DataModel::DeviceTypeEntry>(deviceTypes);
+        config.clusters    = Span<BridgedCluster * const>(clusters);
+        return config;
+    }
+};
+
+class TestBridgeDataModelProvider : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(mProvider.Startup(DataModel::InteractionModelContext{ nullptr, &mListener, nullptr }), CHIP_NO_ERROR);
+    }
+
+protected:
+    StaticProvider mStaticProvider;
+    TestChangeListener mListener;
+    BridgeDataModelProvider mProvider{ mStaticProvider };
+};
+
+bool ContainsPath(const std::vector<AttributePathParams> & paths, const AttributePathParams & path)
+{
+    for (const auto & item : paths)
+    {
+        if (item == path)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::set<EndpointId> ListEndpoints(DataModel::Provider & provider)
+{
+    std::set<EndpointId> endpoints;
+    for (auto entry = provider.FirstEndpoint(); entry.IsValid(); entry = provider.NextEndpoint(entry.id))
+    {
+        EXPECT_TRUE(endpoints.insert(entry.id).second);
+    }
+    return endpoints;
+}
+
+template <typename T>
+std::vector<T> ReadList(DataModel::Provider & provider, const ConcreteAttributePath & path)
+{
+    std::vector<T> values;
+    ReadOperation testRequest(path);
+    std::unique_ptr<AttributeValueEncoder> encoder = testRequest.StartEncoding();
+    EXPECT_EQ(provider.ReadAttribute(testRequest.GetRequest(), *encoder), CHIP_NO_ERROR);
+    EXPECT_EQ(testRequest.FinishEncoding(), CHIP_NO_ERROR);
+
+    std::vector<DecodedAttributeData> attributeData;
+    EXPECT_EQ(testRequest.GetEncodedIBs().Decode(attributeData), CHIP_NO_ERROR);
+    VerifyOrReturnValue(attributeData.size() == 1u, values);
+
+    DataModel::DecodableList<T> list;
+    EXPECT_EQ(DataModel::Decode(attributeData[0].dataReader, list), CHIP_NO_ERROR);
+    auto iterator = list.begin();
+    while (iterator.Next())
+    {
+        values.push_back(iterator.GetValue());
+    }
+    EXPECT_EQ(iterator.GetStatus(), CHIP_NO_ERROR);
+    return values;
+}
+
+TEST_F(TestBridgeDataModelProvider, TestAddAndRemoveEndpoints)
+{
+    BridgedLight light1;
+    BridgedLight light2;
+
+    EXPECT_EQ(ListEndpoints(mProvider), (std::set<EndpointId>{ kRootEndpointId, kAggregatorEndpoint }));
+
+    ASSERT_EQ(mProvider.AddEndpoint(light1.Config(kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+    ASSERT_EQ(mProvider.AddEndpoint(light2.Config(kFirstBridgedEndpoint + 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(mProvider.GetBridgedEndpointCount(), 2u);
+    EXPECT_EQ(ListEndpoints(mProvider),
+              (std::set<EndpointId>{ kRootEndpointId, kAggregatorEndpoint, kFirstBridgedEndpoint, kFirstBridgedEndpoint + 1 }));
+
+    // Endpoint ids are unique across the static and bridged endpoints, and parents have to exist
+    EXPECT_EQ(mProvider.AddEndpoint(light1.Config(kAggregatorEndpoint)), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(mProvider.AddEndpoint(light1.Config(kFirstBridgedEndpoint)), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(mProvider.AddEndpoint(light1.Config(100, 99)), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The new endpoint is reported, as well as the PartsList of the aggregator and of the root endpoint
+    EXPECT_TRUE(ContainsPath(mListener.mDirtyPaths, AttributePathParams(kFirstBridgedEndpoint)));
+    EXPECT_TRUE(ContainsPath(mStaticProvider.mReportedPaths,
+                             AttributePathParams(kAggregatorEndpoint, Descriptor::Id, Descriptor::Attributes::PartsList::Id)));
+    EXPECT_TRUE(ContainsPath(mStaticProvider.mReportedPaths,
+                             AttributePathParams(kRootEndpointId, Descriptor::Id, Descriptor::Attributes::PartsList::Id)));
+
+    auto info = mProvider.GetEndpointInfo(kFirstBridgedEndpoint);
+    ASSERT_TRUE(info.has_value());
+    EXPECT_EQ(info->parentId, kAggregatorEndpoint);
+
+    mStaticProvider.mReportedPaths.clear();
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint), CHIP_NO_ERROR);
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint), CHIP_ERROR_NOT_FOUND);
+    EXPECT_FALSE(mProvider.EndpointExists(kFirstBridgedEndpoint));
+    EXPECT_TRUE(mProvider.EndpointExists(kFirstBridgedEndpoint + 1));
+    EXPECT_TRUE(ContainsPath(mStaticProvider.mReportedPaths,
+                             AttributePathParams(kAggregatorEndpoint, Descriptor::Id, Descriptor::Attributes::PartsList::Id)));
+    EXPECT_EQ(ListEndpoints(mProvider),
+              (std::set<EndpointId>{ kRootEndpointId, kAggregatorEndpoint, kFirstBridgedEndpoint + 1 }));
+}
+
+TEST_F(TestBridgeDataModelProvider, TestRemoveEndpointWithChildren)
+{
+    BridgedLight parent;
+    BridgedLight child;
+    BridgedLight grandChild;
+
+    ASSERT_EQ(mProvider.AddEndpoint(parent.Config(kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+    ASSERT_EQ(mProvider.AddEndpoint(child.Config(kFirstBridgedEndpoint + 1, kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+    ASSERT_EQ(mProvider.AddEndpoint(grandChild.Config(kFirstBridgedEndpoint + 2, kFirstBridgedEndpoint + 1)), CHIP_NO_ERROR);
+
+    // Endpoints with children stay until their children are gone
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint + 1), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(mProvider.GetBridgedEndpointCount(), 3u);
+    EXPECT_EQ(ReadList<EndpointId>(mProvider, ConcreteAttributePath(kFirstBridgedEndpoint, Descriptor::Id,
+                                                                    Descriptor::Attributes::PartsList::Id)),
+              (std::vector<EndpointId>{ kFirstBridgedEndpoint + 1, kFirstBridgedEndpoint + 2 }));
+
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint + 2), CHIP_NO_ERROR);
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint + 1), CHIP_NO_ERROR);
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint), CHIP_NO_ERROR);
+    EXPECT_EQ(mProvider.GetBridgedEndpointCount(), 0u);
+    EXPECT_EQ(ListEndpoints(mProvider), (std::set<EndpointId>{ kRootEndpointId, kAggregatorEndpoint }));
+}
+
+TEST_F(TestBridgeDataModelProvider, TestBridgedEndpointMetadata)
+{
+    BridgedLight light;
+    ASSERT_EQ(mProvider.AddEndpoint(light.Config(kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+
+    // Descriptor first, followed by the bridged clusters
+    auto cluster = mProvider.FirstServerCluster(kFirstBridgedEndpoint);
+    ASSERT_TRUE(cluster.IsValid());
+    EXPECT_EQ(cluster.path.mClusterId, Descriptor::Id);
+    cluster = mProvider.NextServerCluster(cluster.path);
+    ASSERT_TRUE(cluster.IsValid());
+    EXPECT_EQ(cluster.path.mClusterId, OnOff::Id);
+    EXPECT_EQ(cluster.info.dataVersion, light.onOff.GetDataVersion());
+    EXPECT_FALSE(mProvider.NextServerCluster(cluster.path).IsValid());
+
+    auto deviceType = mProvider.FirstDeviceType(kFirstBridgedEndpoint);
+    ASSERT_TRUE(deviceType.has_value());
+    EXPECT_EQ(deviceType->deviceTypeId, kOnOffLightDeviceType);
+    deviceType = mProvider.NextDeviceType(kFirstBridgedEndpoint, *deviceType);
+    ASSERT_TRUE(deviceType.has_value());
+    EXPECT_EQ(deviceType->deviceTypeId, kBridgedNodeDeviceType);
+    EXPECT_FALSE(mProvider.NextDeviceType(kFirstBridgedEndpoint, *deviceType).has_value());
+
+    auto command = mProvider.FirstAcceptedCommand(ConcreteClusterPath(kFirstBridgedEndpoint, OnOff::Id));
+    ASSERT_TRUE(command.IsValid());
+    EXPECT_EQ(command.path.mCommandId, OnOff::Commands::Toggle::Id);
+    EXPECT_FALSE(mProvider.NextAcceptedCommand(command.path).IsValid());
+
+    EXPECT_EQ(ReadList<ClusterId>(mProvider, ConcreteAttributePath(kFirstBridgedEndpoint, Descriptor::Id,
+                                                                   Descriptor::Attributes::ServerList::Id)),
+              (std::vector<ClusterId>{ Descriptor::Id, OnOff::Id }));
+    EXPECT_EQ(ReadList<AttributeId>(mProvider, ConcreteAttributePath(kFirstBridgedEndpoint, OnOff::Id,
+                                                                     Globals::Attributes::AttributeList::Id)),
+              (std::vector<AttributeId>{ OnOff::Attributes::OnOff::Id, Globals::Attributes::GeneratedCommandList::Id,
+                                         Globals::Attributes::AcceptedCommandList::Id, Globals::Attributes::AttributeList::Id,
+                                         OnOff::Attributes::FeatureMap::Id, OnOff::Attributes::ClusterRevision::Id }));
+
+    // Bridged endpoints under another bridged endpoint show up in its PartsList
+    BridgedLight child;
+    ASSERT_EQ(mProvider.AddEndpoint(child.Config(kFirstBridgedEndpoint + 1, kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadList<EndpointId>(mProvider, ConcreteAttributePath(kFirstBridgedEndpoint, Descriptor::Id,
+                                                                    Descriptor::Attributes::PartsList::Id)),
+              (std::vector<EndpointId>{ kFirstBridgedEndpoint + 1 }));
+    EXPECT_TRUE(ContainsPath(mListener.mDirtyPaths,
+                             AttributePathParams(kFirstBridgedEndpoint, Descriptor::Id, Descriptor::Attributes::PartsList::Id)));
+    EXPECT_EQ(mProvider.RemoveEndpoint(kFirstBridgedEndpoint + 1), CHIP_NO_ERROR);
+    EXPECT_TRUE(ReadList<EndpointId>(mProvider, ConcreteAttributePath(kFirstBridgedEndpoint, Descriptor::Id,
+                                                                      Descriptor::Attributes::PartsList::Id))
+                    .empty());
+}
+
+TEST_F(TestBridgeDataModelProvider, TestReadWriteBridgedAttribute)
+{
+    BridgedLight light;
+    ASSERT_EQ(mProvider.AddEndpoint(light.Config(kFirstBridgedEndpoint)), CHIP_NO_ERROR);
+
+    const ConcreteAttributePath onOffPath(kFirstBridgedEndpoint, OnOff::Id, OnOff::Attributes::OnOff::Id);
+    const DataVersion versionBeforeWrite = light.onOff.GetDataVersion();
+    mListener.mDirtyPaths.clear();
+
+    WriteOperation writeRequest(onOffPath);
+    writeRequest.SetOperationFlags(DataModel::OperationFlags::kInternal);
+    AttributeValueDecoder decoder = writeRequest.DecoderFor<bool>(true);
+    ASSERT_EQ(mProvider.WriteAttribute(writeRequest.GetRequest(), decoder), CHIP_NO_ERROR);
+    EXPECT_TRUE(light.onOff.mOn);
+    EXPECT_EQ(light.onOff.GetDataVersion(), versionBeforeWrite + 1);
+    EXPECT_TRUE(ContainsPath(mListener.mDirtyPaths, AttributePathParams(onOffPath.mEndpointId, onOffPath.mClusterId,
+                                                                        onOffPath.mAttributeId)));
+
+    // Writes with a stale data version are rejected
+    WriteOperation staleWriteRequest(onOffPath);
+    staleWriteRequest.SetOperationFlags(DataModel::OperationFlags::kInternal);
+    staleWriteRequest.SetDataVersion(MakeOptional(versionBeforeWrite));
+    AttributeValueDecoder staleDecoder = staleWriteRequest.DecoderFor<bool>(false);
+    EXPECT_EQ(mProvider.WriteAttribute(staleWriteRequest.GetRequest(), staleDecoder), Status::DataVersionMismatch);
+
+    // Descriptor attributes are read-only
+    WriteOperation descriptorWriteRequest(kFirstBridgedEndpoint, Descriptor::Id, Descriptor::Attributes::FeatureMap::Id);
+    descriptorWriteRequest.SetOperationFlags(DataModel::OperationFlags::kInternal);
+    AttributeValueDecoder descriptorDecoder = descriptorWriteRequest.DecoderFor<uint32_t>(1);
+    EXPECT_EQ(mProvider.WriteAttribute(descriptorWriteRequest.GetRequest(), descriptorDecoder), Status::UnsupportedWrite);
+
+    ReadOperation readRequest(onOffPath);
+    std::unique_ptr<AttributeValueEncoder> encoder = readRequest.StartEncoding();
+    ASSERT_EQ(mProvider.ReadAttribute(readRequest.GetRequest(), *encoder), CHIP_NO_ERROR);
+    ASSERT_EQ(readRequest.FinishEncoding(), CHIP_NO_ERROR);
+
+    std::vector<DecodedAttributeData> attributeData;
+    ASSERT_EQ(readRequest.GetEncodedIBs().Decode(attributeData), CHIP_NO_ERROR);
+    ASSERT_EQ(attributeData.size(), 1u);
+    bool value = false;
+    ASSERT_EQ(DataModel::Decode(attributeData[0].dataReader, value), CHIP_NO_ERROR);
+    EXPECT_TRUE(value);
+
+    ReadOperation missingRequest(kFirstBridgedEndpoint, LevelControl::Id, LevelControl::Attributes::CurrentLevel::Id);
+    std::unique_ptr<AttributeValueEncoder> missingEncoder = missingRequest.StartEncoding();
+    EXPECT_EQ(mProvider.ReadAttribute(missingRequest.GetRequest(), *missingEncoder), Status::UnsupportedCluster);
+}
+
+TEST_F(TestBridgeDataModelProvider, TestManyEndpointsWildcardRead)
+{
+    constexpr size_t kBridgedDeviceCount = 1000;
+
+    std::vector<std::unique_ptr<BridgedLight>> lights;
+    for (size_t i = 0; i < kBridgedDeviceCount; i++)
+    {
+        lights.push_back(std::make_unique<BridgedLight>());
+        ASSERT_EQ(mProvider.AddEndpoint(lights.back()->Config(static_cast<EndpointId>(kFirstBridgedEndpoint + i))), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mProvider.GetBridgedEndpointCount(), kBridgedDeviceCount);
+
+    // Expand the equivalent of a wildcard read over the bridged endpoints and read every attribute
+    size_t endpointCount  = 0;
+    size_t attributeCount = 0;
+    for (auto endpoint = mProvider.FirstEndpoint(); endpoint.IsValid(); endpoint = mProvider.NextEndpoint(endpoint.id))
+    {
+        endpointCount++;
+        for (auto cluster = mProvider.FirstServerCluster(endpoint.id); cluster.IsValid();
+             cluster      = mProvider.NextServerCluster(cluster.path))
+        {
+            for (auto attribute = mProvider.FirstAttribute(cluster.path); attribute.IsValid();
+                 attribute      = mProvider.NextAttribute(attribute.path))
+            {
+                ReadOperation readRequest(attribute.path);
+                std::unique_ptr<AttributeValueEncoder> encoder = readRequest.StartEncoding();
+                ASSERT_EQ(mProvider.ReadAttribute(readRequest.GetRequest(), *encoder), CHIP_NO_ERROR);
+                ASSERT_EQ(readRequest.FinishEncoding(), CHIP_NO_ERROR);
+                attributeCount++;
+            }
+        }
+    }
+    EXPECT_EQ(endpointCount, kBridgedDeviceCount + 2);
+    EXPECT_EQ(attributeCount, kBridgedDeviceCount * (6 /* Descriptor */ + 3 /* OnOff */));
+
+    // Removing in any order keeps the remaining endpoints reachable
+    for (size_t i = 0; i < kBridgedDeviceCount; i += 2)
+    {
+        ASSERT_EQ(mProvider.RemoveEndpoint(static_cast<EndpointId>(kFirstBridgedEndpoint + i)), CHIP_NO_ERROR);
+    }
+    for (size_t i = 1; i < kBridgedDeviceCount; i += 2)
+    {
+        EXPECT_TRUE(mProvider.EndpointExists(static_cast<EndpointId>(kFirstBridgedEndpoint + i)));
+    }
+    EXPECT_EQ(ListEndpoints(mProvider).size(), kBridgedDeviceCount / 2 + 2);
+    for (size_t i = 1; i < kBridgedDeviceCount; i += 2)
+    {
+        ASSERT_EQ(mProvider.RemoveEndpoint(static_cast<EndpointId>(kFirstBridgedEndpoint + i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mProvider.GetBridgedEndpointCount(), 0u);
+}
+
+} // namespace
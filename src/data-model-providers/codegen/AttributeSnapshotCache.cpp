@@ -0,0 +1,120 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <data-model-providers/codegen/AttributeSnapshotCache.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+/// Re-encodes an already TLV-encoded value with the tag requested by the encoder
+class EncodedValue
+{
+public:
+    // Only values of non-list ember attributes are cached
+    static constexpr bool kIsFabricScoped = false;
+
+    explicit EncodedValue(ByteSpan encoded) : mEncoded(encoded) {}
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        TLV::TLVReader reader;
+        reader.Init(mEncoded);
+        ReturnErrorOnFailure(reader.Next());
+        return writer.CopyElement(tag, reader);
+    }
+
+private:
+    ByteSpan mEncoded;
+};
+
+} // namespace
+
+std::optional<CHIP_ERROR> AttributeSnapshotCache::Encode(const ConcreteAttributePath & path, DataVersion dataVersion,
+                                                         AttributeValueEncoder & encoder)
+{
+    Entry * entry = Find(path);
+    if ((entry == nullptr) || (entry->dataVersion != dataVersion))
+    {
+        mMissCount++;
+        return std::nullopt;
+    }
+
+    mHitCount++;
+    entry->lastUsed = ++mUsageClock;
+    return encoder.Encode(EncodedValue(ByteSpan(entry->encoded, entry->encodedLength)));
+}
+
+void AttributeSnapshotCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.encodedLength = 0;
+    }
+    mUsageClock = 0;
+}
+
+AttributeSnapshotCache::Entry * AttributeSnapshotCache::Find(const ConcreteAttributePath & path)
+{
+    for (auto & entry : mEntries)
+    {
+        if ((entry.encodedLength != 0) && (entry.path == path))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void AttributeSnapshotCache::Add(const ConcreteAttributePath & path, DataVersion dataVersion, ByteSpan encoded)
+{
+    VerifyOrReturn(!mEntries.empty());
+    VerifyOrReturn(!encoded.empty() && (encoded.size() <= kMaxEncodedValueSize));
+
+    // Replace the value of the same path if there is one, otherwise a free entry or the
+    // least recently used one.
+    Entry * entry = Find(path);
+    if (entry == nullptr)
+    {
+        entry = &mEntries[0];
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.encodedLength == 0)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (candidate.lastUsed < entry->lastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->path          = path;
+    entry->dataVersion   = dataVersion;
+    entry->lastUsed      = ++mUsageClock;
+    entry->encodedLength = static_cast<uint8_t>(encoded.size());
+    memcpy(entry->encoded, encoded.data(), encoded.size());
+}
+
+} // namespace app
+} // namespace chip
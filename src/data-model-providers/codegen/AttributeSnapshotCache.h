@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributeValueEncoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/Span.h>
+
+#include <optional>
+
+namespace chip {
+namespace app {
+
+/// Keeps the TLV encoding of recently read attribute values, keyed by attribute path and
+/// by the data version of the cluster at the time of the read.
+///
+/// A cached value is only served while the cluster data version is unchanged, so values
+/// that are read over and over (by several subscribers, or when reports are re-encoded)
+/// are encoded only once per change.
+///
+/// Callers are responsible for only caching values that cannot change without the data
+/// version of their cluster changing and for calling `Clear` when that is no longer true
+/// (e.g. when the data model structure changes).
+class AttributeSnapshotCache
+{
+public:
+    /// Large enough for the 64 character strings of the Basic Information cluster.
+    static constexpr size_t kMaxEncodedValueSize = 68;
+
+    struct Entry
+    {
+        ConcreteAttributePath path;
+        DataVersion dataVersion = 0;
+        uint32_t lastUsed       = 0;
+        uint8_t encodedLength   = 0; // 0 for unused entries
+        uint8_t encoded[kMaxEncodedValueSize];
+    };
+
+    explicit AttributeSnapshotCache(Span<Entry> entries) : mEntries(entries) {}
+    virtual ~AttributeSnapshotCache() = default;
+
+    AttributeSnapshotCache(const AttributeSnapshotCache &)             = delete;
+    AttributeSnapshotCache & operator=(const AttributeSnapshotCache &) = delete;
+
+    /// Encodes the value cached for `path` at `dataVersion` into `encoder`.
+    ///
+    /// Returns std::nullopt (having encoded nothing) if there is no such value, otherwise
+    /// the result of the encoding.
+    std::optional<CHIP_ERROR> Encode(const ConcreteAttributePath & path, DataVersion dataVersion, AttributeValueEncoder & encoder);
+
+    /// Caches the value of the attribute at `path` for `dataVersion`.
+    ///
+    /// Values that cannot be encoded or whose encoding is larger than kMaxEncodedValueSize
+    /// are not cached.
+    template <typename T>
+    void Store(const ConcreteAttributePath & path, DataVersion dataVersion, T && value)
+    {
+        uint8_t buffer[kMaxEncodedValueSize];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        VerifyOrReturn(DataModel::Encode(writer, TLV::AnonymousTag(), value) == CHIP_NO_ERROR);
+        VerifyOrReturn(writer.Finalize() == CHIP_NO_ERROR);
+        Add(path, dataVersion, ByteSpan(buffer, writer.GetLengthWritten()));
+    }
+
+    /// Drops all cached values.
+    void Clear();
+
+    size_t GetHitCount() const { return mHitCount; }
+    size_t GetMissCount() const { return mMissCount; }
+
+private:
+    Span<Entry> mEntries;
+    uint32_t mUsageClock = 0;
+    size_t mHitCount     = 0;
+    size_t mMissCount    = 0;
+
+    Entry * Find(const ConcreteAttributePath & path);
+    void Add(const ConcreteAttributePath & path, DataVersion dataVersion, ByteSpan encoded);
+};
+
+template <size_t kEntryCount>
+class AttributeSnapshotCacheWithStorage : public AttributeSnapshotCache
+{
+public:
+    AttributeSnapshotCacheWithStorage() : AttributeSnapshotCache(Span<Entry>(mStorage)) {}
+
+private:
+    Entry mStorage[kEntryCount];
+};
+
+} // namespace app
+} // namespace chip
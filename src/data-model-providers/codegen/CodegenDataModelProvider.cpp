@@ -298,6 +298,25 @@ std::optional<DataModel::DeviceTypeEntry> DeviceTypeEntryFromEmber(const EmberAf
 
 const ConcreteCommandPath kInvalidCommandPath(kInvalidEndpointId, kInvalidClusterId, kInvalidCommandId);
 
+/// Returns the ember structure remembered in the cursor for the given endpoint, unless the cursor was used for another
+/// endpoint or the ember metadata changed since it was stored. Endpoints of the same type share their ember structures, so
+/// the structure alone does not tell which endpoint it was found for.
+template <typename T>
+const T * CursorContainer(const DataModel::MetadataCursor & cursor, EndpointId endpointId)
+{
+    VerifyOrReturnValue(cursor.endpoint == endpointId, nullptr);
+    VerifyOrReturnValue(cursor.generation == emberAfMetadataStructureGeneration(), nullptr);
+    return static_cast<const T *>(cursor.container);
+}
+
+template <typename T>
+void SetCursorContainer(DataModel::MetadataCursor & cursor, EndpointId endpointId, const T * container)
+{
+    cursor.container  = container;
+    cursor.endpoint   = endpointId;
+    cursor.generation = emberAfMetadataStructureGeneration();
+}
+
 std::optional<DataModel::EndpointInfo> GetEndpointInfoAtIndex(uint16_t endpointIndex)
 {
     VerifyOrReturnValue(emberAfEndpointIndexIsEnabled(endpointIndex), std::nullopt);
@@ -520,7 +539,7 @@ bool CodegenDataModelProvider::EndpointExists(EndpointId endpoint)
 
 std::optional<DataModel::EndpointInfo> CodegenDataModelProvider::GetEndpointInfo(EndpointId endpoint)
 {
-    std::optional<unsigned> endpoint_idx = TryFindEndpointIndex(endpoint);
+    std::optional<unsigned> endpoint_idx = TryFindEndpointIndex(endpoint, mEndpointIterationHint);
     if (endpoint_idx.has_value())
     {
         return GetEndpointInfoAtIndex(static_cast<uint16_t>(*endpoint_idx));
@@ -533,14 +552,14 @@ DataModel::EndpointEntry CodegenDataModelProvider::FirstEndpoint()
     return FirstEndpointEntry(0, mEndpointIterationHint);
 }
 
-std::optional<unsigned> CodegenDataModelProvider::TryFindEndpointIndex(EndpointId id) const
+std::optional<unsigned> CodegenDataModelProvider::TryFindEndpointIndex(EndpointId id, unsigned hint) const
 {
     const uint16_t lastEndpointIndex = emberAfEndpointCount();
 
-    if ((mEndpointIterationHint < lastEndpointIndex) && emberAfEndpointIndexIsEnabled(mEndpointIterationHint) &&
-        (id == emberAfEndpointFromIndex(mEndpointIterationHint)))
+    if ((hint < lastEndpointIndex) && emberAfEndpointIndexIsEnabled(static_cast<uint16_t>(hint)) &&
+        (id == emberAfEndpointFromIndex(static_cast<uint16_t>(hint))))
     {
-        return std::make_optional(mEndpointIterationHint);
+        return std::make_optional(hint);
     }
 
     // Linear search, this may be slow
@@ -555,7 +574,7 @@ std::optional<unsigned> CodegenDataModelProvider::TryFindEndpointIndex(EndpointI
 
 DataModel::EndpointEntry CodegenDataModelProvider::NextEndpoint(EndpointId before)
 {
-    std::optional<unsigned> before_idx = TryFindEndpointIndex(before);
+    std::optional<unsigned> before_idx = TryFindEndpointIndex(before, mEndpointIterationHint);
     if (!before_idx.has_value())
     {
         return DataModel::EndpointEntry::kInvalid;
@@ -563,6 +582,25 @@ DataModel::EndpointEntry CodegenDataModelProvider::NextEndpoint(EndpointId befor
     return FirstEndpointEntry(*before_idx + 1, mEndpointIterationHint);
 }
 
+DataModel::EndpointEntry CodegenDataModelProvider::FirstEndpointWithCursor(DataModel::MetadataCursor & cursor)
+{
+    uint16_t found_index           = 0;
+    DataModel::EndpointEntry entry = FirstEndpointEntry(0, found_index);
+    cursor.index                   = found_index;
+    return entry;
+}
+
+DataModel::EndpointEntry CodegenDataModelProvider::NextEndpointWithCursor(EndpointId before, DataModel::MetadataCursor & cursor)
+{
+    std::optional<unsigned> before_idx = TryFindEndpointIndex(before, cursor.index);
+    VerifyOrReturnValue(before_idx.has_value(), DataModel::EndpointEntry::kInvalid);
+
+    uint16_t found_index           = 0;
+    DataModel::EndpointEntry entry = FirstEndpointEntry(*before_idx + 1, found_index);
+    cursor.index                   = found_index;
+    return entry;
+}
+
 DataModel::ClusterEntry CodegenDataModelProvider::FirstServerCluster(EndpointId endpointId)
 {
     const EmberAfEndpointType * endpoint = emberAfFindEndpointType(endpointId);
@@ -574,10 +612,9 @@ DataModel::ClusterEntry CodegenDataModelProvider::FirstServerCluster(EndpointId
 }
 
 std::optional<unsigned> CodegenDataModelProvider::TryFindClusterIndex(const EmberAfEndpointType * endpoint, ClusterId id,
-                                                                      ClusterSide side) const
+                                                                      ClusterSide side, unsigned hint) const
 {
     const unsigned clusterCount = endpoint->clusterCount;
-    unsigned hint               = side == ClusterSide::kServer ? mServerClusterIterationHint : mClientClusterIterationHint;
 
     if (hint < clusterCount)
     {
@@ -620,7 +657,8 @@ DataModel::ClusterEntry CodegenDataModelProvider::NextServerCluster(const Concre
     VerifyOrReturnValue(endpoint->clusterCount > 0, DataModel::ClusterEntry::kInvalid);
     VerifyOrReturnValue(endpoint->cluster != nullptr, DataModel::ClusterEntry::kInvalid);
 
-    std::optional<unsigned> cluster_idx = TryFindClusterIndex(endpoint, before.mClusterId, ClusterSide::kServer);
+    std::optional<unsigned> cluster_idx =
+        TryFindClusterIndex(endpoint, before.mClusterId, ClusterSide::kServer, mServerClusterIterationHint);
     if (!cluster_idx.has_value())
     {
         return DataModel::ClusterEntry::kInvalid;
@@ -629,6 +667,39 @@ DataModel::ClusterEntry CodegenDataModelProvider::NextServerCluster(const Concre
     return FirstServerClusterEntry(before.mEndpointId, endpoint, *cluster_idx + 1, mServerClusterIterationHint);
 }
 
+DataModel::ClusterEntry CodegenDataModelProvider::FirstServerClusterWithCursor(EndpointId endpointId,
+                                                                               DataModel::MetadataCursor & cursor)
+{
+    const EmberAfEndpointType * endpoint = emberAfFindEndpointType(endpointId);
+    VerifyOrReturnValue(endpoint != nullptr, DataModel::ClusterEntry::kInvalid);
+    VerifyOrReturnValue(endpoint->clusterCount > 0, DataModel::ClusterEntry::kInvalid);
+    VerifyOrReturnValue(endpoint->cluster != nullptr, DataModel::ClusterEntry::kInvalid);
+
+    SetCursorContainer(cursor, endpointId, endpoint);
+    return FirstServerClusterEntry(endpointId, endpoint, 0, cursor.index);
+}
+
+DataModel::ClusterEntry CodegenDataModelProvider::NextServerClusterWithCursor(const ConcreteClusterPath & before,
+                                                                              DataModel::MetadataCursor & cursor)
+{
+    // The cursor remembers the endpoint, so that the endpoint list does not have to be searched on every call.
+    const EmberAfEndpointType * endpoint = CursorContainer<EmberAfEndpointType>(cursor, before.mEndpointId);
+    if (endpoint == nullptr)
+    {
+        endpoint = emberAfFindEndpointType(before.mEndpointId);
+        VerifyOrReturnValue(endpoint != nullptr, DataModel::ClusterEntry::kInvalid);
+        SetCursorContainer(cursor, before.mEndpointId, endpoint);
+    }
+
+    VerifyOrReturnValue(endpoint->clusterCount > 0, DataModel::ClusterEntry::kInvalid);
+    VerifyOrReturnValue(endpoint->cluster != nullptr, DataModel::ClusterEntry::kInvalid);
+
+    std::optional<unsigned> cluster_idx = TryFindClusterIndex(endpoint, before.mClusterId, ClusterSide::kServer, cursor.index);
+    VerifyOrReturnValue(cluster_idx.has_value(), DataModel::ClusterEntry::kInvalid);
+
+    return FirstServerClusterEntry(before.mEndpointId, endpoint, *cluster_idx + 1, cursor.index);
+}
+
 std::optional<DataModel::ClusterInfo> CodegenDataModelProvider::GetServerClusterInfo(const ConcreteClusterPath & path)
 {
     const EmberAfCluster * cluster = FindServerCluster(path);
@@ -670,7 +741,8 @@ ConcreteClusterPath CodegenDataModelProvider::NextClientCluster(const ConcreteCl
     VerifyOrReturnValue(endpoint->clusterCount > 0, ConcreteClusterPath(before.mEndpointId, kInvalidClusterId));
     VerifyOrReturnValue(endpoint->cluster != nullptr, ConcreteClusterPath(before.mEndpointId, kInvalidClusterId));
 
-    std::optional<unsigned> cluster_idx = TryFindClusterIndex(endpoint, before.mClusterId, ClusterSide::kClient);
+    std::optional<unsigned> cluster_idx =
+        TryFindClusterIndex(endpoint, before.mClusterId, ClusterSide::kClient, mClientClusterIterationHint);
     if (!cluster_idx.has_value())
     {
         return ConcreteClusterPath(before.mEndpointId, kInvalidClusterId);
@@ -691,14 +763,29 @@ DataModel::AttributeEntry CodegenDataModelProvider::FirstAttribute(const Concret
     return AttributeEntryFrom(path, cluster->attributes[0]);
 }
 
-std::optional<unsigned> CodegenDataModelProvider::TryFindAttributeIndex(const EmberAfCluster * cluster, AttributeId id) const
+DataModel::AttributeEntry CodegenDataModelProvider::FirstAttributeWithCursor(const ConcreteClusterPath & path,
+                                                                             DataModel::MetadataCursor & cursor)
+{
+    const EmberAfCluster * cluster = FindServerCluster(path);
+
+    VerifyOrReturnValue(cluster != nullptr, DataModel::AttributeEntry::kInvalid);
+    VerifyOrReturnValue(cluster->attributeCount > 0, DataModel::AttributeEntry::kInvalid);
+    VerifyOrReturnValue(cluster->attributes != nullptr, DataModel::AttributeEntry::kInvalid);
+
+    SetCursorContainer(cursor, path.mEndpointId, cluster);
+    cursor.index = 0;
+    return AttributeEntryFrom(path, cluster->attributes[0]);
+}
+
+std::optional<unsigned> CodegenDataModelProvider::TryFindAttributeIndex(const EmberAfCluster * cluster, AttributeId id,
+                                                                        unsigned hint) const
 {
     const unsigned attributeCount = cluster->attributeCount;
 
-    // attempt to find this based on the embedded hint
-    if ((mAttributeIterationHint < attributeCount) && (cluster->attributes[mAttributeIterationHint].attributeId == id))
+    // attempt to find this based on the given hint
+    if ((hint < attributeCount) && (cluster->attributes[hint].attributeId == id))
     {
-        return std::make_optional(mAttributeIterationHint);
+        return std::make_optional(hint);
     }
 
     // linear search is required. This may be slow
@@ -732,6 +819,30 @@ const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const Concret
     return cluster;
 }
 
+void CodegenDataModelProvider::SetAttributeSnapshotCache(AttributeSnapshotCache * cache)
+{
+    mAttributeSnapshotCache = cache;
+    VerifyOrReturn(mAttributeSnapshotCache != nullptr);
+
+    mAttributeSnapshotCache->Clear();
+    mSnapshotCacheStructureGeneration         = emberAfMetadataStructureGeneration();
+    mSnapshotCacheUnversionedChangeGeneration = emberAfUnversionedAttributeChangeGeneration();
+}
+
+AttributeSnapshotCache * CodegenDataModelProvider::ValidAttributeSnapshotCache()
+{
+    VerifyOrReturnValue(mAttributeSnapshotCache != nullptr, nullptr);
+
+    if ((mSnapshotCacheStructureGeneration != emberAfMetadataStructureGeneration()) ||
+        (mSnapshotCacheUnversionedChangeGeneration != emberAfUnversionedAttributeChangeGeneration()))
+    {
+        mAttributeSnapshotCache->Clear();
+        mSnapshotCacheStructureGeneration         = emberAfMetadataStructureGeneration();
+        mSnapshotCacheUnversionedChangeGeneration = emberAfUnversionedAttributeChangeGeneration();
+    }
+    return mAttributeSnapshotCache;
+}
+
 CommandId CodegenDataModelProvider::FindCommand(const ConcreteCommandPath & path, detail::EnumeratorCommandFinder & handlerFinder,
                                                 detail::EnumeratorCommandFinder::Operation operation,
                                                 CodegenDataModelProvider::EmberCommandListIterator & emberIterator,
@@ -769,7 +880,7 @@ DataModel::AttributeEntry CodegenDataModelProvider::NextAttribute(const Concrete
     VerifyOrReturnValue(cluster->attributes != nullptr, DataModel::AttributeEntry::kInvalid);
 
     // find the given attribute in the list and then return the next one
-    std::optional<unsigned> attribute_idx = TryFindAttributeIndex(cluster, before.mAttributeId);
+    std::optional<unsigned> attribute_idx = TryFindAttributeIndex(cluster, before.mAttributeId, mAttributeIterationHint);
     if (!attribute_idx.has_value())
     {
         return DataModel::AttributeEntry::kInvalid;
@@ -786,6 +897,31 @@ DataModel::AttributeEntry CodegenDataModelProvider::NextAttribute(const Concrete
     return DataModel::AttributeEntry::kInvalid;
 }
 
+DataModel::AttributeEntry CodegenDataModelProvider::NextAttributeWithCursor(const ConcreteAttributePath & before,
+                                                                            DataModel::MetadataCursor & cursor)
+{
+    // The cursor remembers the cluster, so that neither endpoints nor clusters have to be searched on every call.
+    const EmberAfCluster * cluster = CursorContainer<EmberAfCluster>(cursor, before.mEndpointId);
+    if ((cluster == nullptr) || (cluster->clusterId != before.mClusterId))
+    {
+        cluster = FindServerCluster(before);
+        VerifyOrReturnValue(cluster != nullptr, DataModel::AttributeEntry::kInvalid);
+        SetCursorContainer(cursor, before.mEndpointId, cluster);
+    }
+
+    VerifyOrReturnValue(cluster->attributeCount > 0, DataModel::AttributeEntry::kInvalid);
+    VerifyOrReturnValue(cluster->attributes != nullptr, DataModel::AttributeEntry::kInvalid);
+
+    std::optional<unsigned> attribute_idx = TryFindAttributeIndex(cluster, before.mAttributeId, cursor.index);
+    VerifyOrReturnValue(attribute_idx.has_value(), DataModel::AttributeEntry::kInvalid);
+
+    unsigned next_idx = *attribute_idx + 1;
+    VerifyOrReturnValue(next_idx < cluster->attributeCount, DataModel::AttributeEntry::kInvalid);
+
+    cursor.index = next_idx;
+    return AttributeEntryFrom(before, cluster->attributes[next_idx]);
+}
+
 std::optional<DataModel::AttributeInfo> CodegenDataModelProvider::GetAttributeInfo(const ConcreteAttributePath & path)
 {
     const EmberAfCluster * cluster = FindServerCluster(path);
@@ -794,7 +930,7 @@ std::optional<DataModel::AttributeInfo> CodegenDataModelProvider::GetAttributeIn
     VerifyOrReturnValue(cluster->attributeCount > 0, std::nullopt);
     VerifyOrReturnValue(cluster->attributes != nullptr, std::nullopt);
 
-    std::optional<unsigned> attribute_idx = TryFindAttributeIndex(cluster, path.mAttributeId);
+    std::optional<unsigned> attribute_idx = TryFindAttributeIndex(cluster, path.mAttributeId, mAttributeIterationHint);
 
     if (!attribute_idx.has_value())
     {
@@ -875,7 +1011,7 @@ std::optional<DataModel::DeviceTypeEntry> CodegenDataModelProvider::FirstDeviceT
     // during `Next` loops. This avoids O(n^2) on number of indexes when iterating over all device types.
     //
     // Not actually needed for `First`, however this makes First and Next consistent.
-    std::optional<unsigned> endpoint_index = TryFindEndpointIndex(endpoint);
+    std::optional<unsigned> endpoint_index = TryFindEndpointIndex(endpoint, mEndpointIterationHint);
     if (!endpoint_index.has_value())
     {
         return std::nullopt;
@@ -894,7 +1030,7 @@ std::optional<DataModel::DeviceTypeEntry> CodegenDataModelProvider::NextDeviceTy
     // Use the `Index` version even though `emberAfDeviceTypeListFromEndpoint` would work because
     // index finding is cached in TryFindEndpointIndex and this avoids an extra `emberAfIndexFromEndpoint`
     // during `Next` loops. This avoids O(n^2) on number of indexes when iterating over all device types.
-    std::optional<unsigned> endpoint_index = TryFindEndpointIndex(endpoint);
+    std::optional<unsigned> endpoint_index = TryFindEndpointIndex(endpoint, mEndpointIterationHint);
     if (!endpoint_index.has_value())
     {
         return std::nullopt;
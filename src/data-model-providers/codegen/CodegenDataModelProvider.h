@@ -22,6 +22,7 @@
 #include <app/ConcreteCommandPath.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/util/af-types.h>
+#include <data-model-providers/codegen/AttributeSnapshotCache.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 
 namespace chip {
@@ -138,6 +139,16 @@ public:
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
 
+    /// Enables caching of encoded attribute values (nullptr, the default, disables it).
+    ///
+    /// Only values read from ember RAM storage of clusters without an AttributeAccessInterface
+    /// are cached, since only those are guaranteed to change together with the cluster data
+    /// version. Singleton attributes are not cached either: their storage is shared by all
+    /// endpoints, but a write only changes the data version of the endpoint it targets. The
+    /// cache is cleared whenever ember metadata changes.
+    void SetAttributeSnapshotCache(AttributeSnapshotCache * cache);
+    AttributeSnapshotCache * GetAttributeSnapshotCache() { return mAttributeSnapshotCache; }
+
     /// Generic model implementations
     CHIP_ERROR Shutdown() override
     {
@@ -157,6 +168,8 @@ public:
     /// attribute tree iteration
     DataModel::EndpointEntry FirstEndpoint() override;
     DataModel::EndpointEntry NextEndpoint(EndpointId before) override;
+    DataModel::EndpointEntry FirstEndpointWithCursor(DataModel::MetadataCursor & cursor) override;
+    DataModel::EndpointEntry NextEndpointWithCursor(EndpointId before, DataModel::MetadataCursor & cursor) override;
     std::optional<DataModel::EndpointInfo> GetEndpointInfo(EndpointId endpoint) override;
     bool EndpointExists(EndpointId endpoint) override;
 
@@ -169,6 +182,9 @@ public:
 
     DataModel::ClusterEntry FirstServerCluster(EndpointId endpoint) override;
     DataModel::ClusterEntry NextServerCluster(const ConcreteClusterPath & before) override;
+    DataModel::ClusterEntry FirstServerClusterWithCursor(EndpointId endpoint, DataModel::MetadataCursor & cursor) override;
+    DataModel::ClusterEntry NextServerClusterWithCursor(const ConcreteClusterPath & before,
+                                                        DataModel::MetadataCursor & cursor) override;
     std::optional<DataModel::ClusterInfo> GetServerClusterInfo(const ConcreteClusterPath & path) override;
 
     ConcreteClusterPath FirstClientCluster(EndpointId endpoint) override;
@@ -176,6 +192,10 @@ public:
 
     DataModel::AttributeEntry FirstAttribute(const ConcreteClusterPath & cluster) override;
     DataModel::AttributeEntry NextAttribute(const ConcreteAttributePath & before) override;
+    DataModel::AttributeEntry FirstAttributeWithCursor(const ConcreteClusterPath & cluster,
+                                                       DataModel::MetadataCursor & cursor) override;
+    DataModel::AttributeEntry NextAttributeWithCursor(const ConcreteAttributePath & before,
+                                                      DataModel::MetadataCursor & cursor) override;
     std::optional<DataModel::AttributeInfo> GetAttributeInfo(const ConcreteAttributePath & path) override;
 
     DataModel::CommandEntry FirstAcceptedCommand(const ConcreteClusterPath & cluster) override;
@@ -227,19 +247,29 @@ private:
     // Ember requires a persistence provider, so we make sure we can always have something
     PersistentStorageDelegate * mPersistentStorageDelegate = nullptr;
 
+    // Optional cache of encoded values and the ember generation counts its content is valid for
+    AttributeSnapshotCache * mAttributeSnapshotCache   = nullptr;
+    unsigned mSnapshotCacheStructureGeneration         = 0;
+    unsigned mSnapshotCacheUnversionedChangeGeneration = 0;
+
+    /// Returns the snapshot cache (nullptr if disabled), clearing it first if ember
+    /// values may have changed without a data version change.
+    AttributeSnapshotCache * ValidAttributeSnapshotCache();
+
     /// Finds the specified ember cluster
     ///
     /// Effectively the same as `emberAfFindServerCluster` except with some caching capabilities
     const EmberAfCluster * FindServerCluster(const ConcreteClusterPath & path);
 
-    /// Find the index of the given attribute id
-    std::optional<unsigned> TryFindAttributeIndex(const EmberAfCluster * cluster, AttributeId id) const;
+    /// Find the index of the given attribute id, checking `hint` (its likely index) first
+    std::optional<unsigned> TryFindAttributeIndex(const EmberAfCluster * cluster, AttributeId id, unsigned hint) const;
 
-    /// Find the index of the given cluster id
-    std::optional<unsigned> TryFindClusterIndex(const EmberAfEndpointType * endpoint, ClusterId id, ClusterSide clusterSide) const;
+    /// Find the index of the given cluster id, checking `hint` (its likely index) first
+    std::optional<unsigned> TryFindClusterIndex(const EmberAfEndpointType * endpoint, ClusterId id, ClusterSide clusterSide,
+                                                unsigned hint) const;
 
-    /// Find the index of the given endpoint id
-    std::optional<unsigned> TryFindEndpointIndex(EndpointId id) const;
+    /// Find the index of the given endpoint id, checking `hint` (its likely index) first
+    std::optional<unsigned> TryFindEndpointIndex(EndpointId id, unsigned hint) const;
 
     using CommandListGetter = const CommandId *(const EmberAfCluster &);
 
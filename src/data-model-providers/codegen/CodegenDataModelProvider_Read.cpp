@@ -38,6 +38,7 @@
 #include <app/util/ember-io-storage.h>
 #include <app/util/endpoint-config-api.h>
 #include <app/util/odd-sized-integers.h>
+#include <data-model-providers/codegen/AttributeSnapshotCache.h>
 #include <data-model-providers/codegen/EmberAttributeDataBuffer.h>
 #include <data-model-providers/codegen/EmberMetadata.h>
 #include <lib/core/CHIPError.h>
@@ -92,8 +93,11 @@ std::optional<CHIP_ERROR> TryReadViaAccessInterface(const ConcreteAttributePath
 
 /// separated-out ReadAttribute implementation (given existing complexity)
 ///
+/// Access control is not checked here: callers (e.g. the reporting engine) validate the ACL before
+/// calling ReadAttribute, so a cached value is only ever served for a read that was already allowed.
+///
 /// Generally will:
-///    - validate ACL (only for non-internal requests)
+///    - Try to serve a previously encoded value from the snapshot cache, if one is set
 ///    - Try to read attribute via the AttributeAccessInterface
 ///    - Try to read the value from ember RAM storage
 DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const DataModel::ReadAttributeRequest & request,
@@ -104,6 +108,21 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
                   ChipLogValueMEI(request.path.mClusterId), request.path.mEndpointId, ChipLogValueMEI(request.path.mAttributeId),
                   request.path.mExpanded);
 
+    // Values only get cached once found in ember storage with no AAI for the cluster, so a cached value
+    // is what the full lookup below would return, as long as no AAI got registered since.
+    AttributeSnapshotCache * snapshotCache = ValidAttributeSnapshotCache();
+    const DataVersion * dataVersion        = nullptr;
+    if (snapshotCache != nullptr)
+    {
+        dataVersion = emberAfDataVersionStorage(request.path);
+        if ((dataVersion != nullptr) &&
+            (AttributeAccessInterfaceRegistry::Instance().Get(request.path.mEndpointId, request.path.mClusterId) == nullptr))
+        {
+            std::optional<CHIP_ERROR> cached = snapshotCache->Encode(request.path, *dataVersion, encoder);
+            VerifyOrReturnError(!cached.has_value(), *cached);
+        }
+    }
+
     auto metadata = Ember::FindAttributeMetadata(request.path);
 
     // Explicit failure in finding a suitable metadata
@@ -117,6 +136,7 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
 
     // Read via AAI
     std::optional<CHIP_ERROR> aai_result;
+    AttributeAccessInterface * clusterAai = nullptr;
     if (const EmberAfCluster ** cluster = std::get_if<const EmberAfCluster *>(&metadata))
     {
         Compatibility::GlobalAttributeReader aai(*cluster);
@@ -124,9 +144,8 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
     }
     else
     {
-        aai_result = TryReadViaAccessInterface(
-            request.path, AttributeAccessInterfaceRegistry::Instance().Get(request.path.mEndpointId, request.path.mClusterId),
-            encoder);
+        clusterAai = AttributeAccessInterfaceRegistry::Instance().Get(request.path.mEndpointId, request.path.mClusterId);
+        aai_result = TryReadViaAccessInterface(request.path, clusterAai, encoder);
     }
     VerifyOrReturnError(!aai_result.has_value(), *aai_result);
 
@@ -156,6 +175,15 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::ReadAttribute(const Data
 
     MutableByteSpan data = gEmberAttributeIOBufferSpan;
     Ember::EmberAttributeDataBuffer emberData(attributeMetadata, data);
+
+    // External attributes are owned by the application and may change at any time. Singletons share their storage between
+    // endpoints, so a write through one endpoint changes the value of the others without changing their data version.
+    if ((snapshotCache != nullptr) && (dataVersion != nullptr) && (clusterAai == nullptr) && !attributeMetadata->IsExternal() &&
+        !attributeMetadata->IsSingleton())
+    {
+        snapshotCache->Store(request.path, *dataVersion, emberData);
+    }
+
     return encoder.Encode(emberData);
 }
 
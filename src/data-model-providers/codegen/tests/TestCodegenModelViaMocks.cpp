@@ -1199,6 +1199,116 @@ TEST(TestCodegenModelViaMocks, IterateOverAttributes)
     }
 }
 
+TEST(TestCodegenModelViaMocks, IterateWithCursors)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    // Cursor iteration returns the same elements as First/Next iteration
+    std::vector<ConcreteAttributePath> expected;
+    for (EndpointEntry ep = model.FirstEndpoint(); ep.IsValid(); ep = model.NextEndpoint(ep.id))
+    {
+        for (ClusterEntry cluster = model.FirstServerCluster(ep.id); cluster.IsValid();
+             cluster              = model.NextServerCluster(cluster.path))
+        {
+            for (AttributeEntry attr = model.FirstAttribute(cluster.path); attr.IsValid(); attr = model.NextAttribute(attr.path))
+            {
+                expected.push_back(attr.path);
+            }
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    std::vector<ConcreteAttributePath> found;
+    MetadataCursor endpointCursor;
+    for (EndpointEntry ep = model.FirstEndpointWithCursor(endpointCursor); ep.IsValid();
+         ep               = model.NextEndpointWithCursor(ep.id, endpointCursor))
+    {
+        MetadataCursor clusterCursor;
+        for (ClusterEntry cluster = model.FirstServerClusterWithCursor(ep.id, clusterCursor); cluster.IsValid();
+             cluster              = model.NextServerClusterWithCursor(cluster.path, clusterCursor))
+        {
+            MetadataCursor attributeCursor;
+            for (AttributeEntry attr = model.FirstAttributeWithCursor(cluster.path, attributeCursor); attr.IsValid();
+                 attr                = model.NextAttributeWithCursor(attr.path, attributeCursor))
+            {
+                // Interleaved lookups do not disturb the iteration
+                EXPECT_TRUE(model.GetAttributeInfo(ConcreteAttributePath(kMockEndpoint1, MockClusterId(1), FeatureMap::Id)));
+                found.push_back(attr.path);
+            }
+        }
+    }
+    EXPECT_TRUE(found == expected);
+
+    // Interleaved iterations over different clusters
+    MetadataCursor cursorA;
+    MetadataCursor cursorB;
+    AttributeEntry a = model.FirstAttributeWithCursor(ConcreteClusterPath(kMockEndpoint2, MockClusterId(2)), cursorA);
+    AttributeEntry b = model.FirstAttributeWithCursor(ConcreteClusterPath(kMockEndpoint3, MockClusterId(2)), cursorB);
+    unsigned countA  = 0;
+    unsigned countB  = 0;
+    while (a.IsValid() || b.IsValid())
+    {
+        if (a.IsValid())
+        {
+            countA++;
+            a = model.NextAttributeWithCursor(a.path, cursorA);
+        }
+        if (b.IsValid())
+        {
+            countB++;
+            b = model.NextAttributeWithCursor(b.path, cursorB);
+        }
+    }
+    EXPECT_EQ(countA, 4u);
+    EXPECT_EQ(countB, 6u);
+
+    // A cursor that predates a data model change is not relied upon
+    MetadataCursor cursor;
+    AttributeEntry entry = model.FirstAttributeWithCursor(ConcreteClusterPath(kMockEndpoint3, MockClusterId(2)), cursor);
+    ASSERT_TRUE(entry.IsValid());
+    SetMockNodeConfig(gTestNodeConfig);
+    entry = model.NextAttributeWithCursor(entry.path, cursor);
+    ASSERT_TRUE(entry.IsValid());
+    EXPECT_EQ(entry.path.mAttributeId, FeatureMap::Id);
+
+    // A cursor does not make an unknown element valid
+    EXPECT_FALSE(model.NextAttributeWithCursor(ConcreteAttributePath(kMockEndpoint3, MockClusterId(2), 987u), cursor).IsValid());
+    EXPECT_FALSE(model.NextEndpointWithCursor(kEndpointIdThatIsMissing, endpointCursor).IsValid());
+}
+
+TEST(TestCodegenModelViaMocks, CursorReusedAcrossEndpoints)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+
+    // A cursor positioned on one endpoint is not relied upon for another endpoint with the same
+    // cluster: endpoint 2 has fewer server clusters and its cluster 2 has fewer attributes than
+    // the ones of endpoint 3.
+    MetadataCursor clusterCursor;
+    ClusterEntry cluster = model.FirstServerClusterWithCursor(kMockEndpoint2, clusterCursor);
+    ASSERT_TRUE(cluster.IsValid());
+    cluster = model.NextServerClusterWithCursor(ConcreteClusterPath(kMockEndpoint3, MockClusterId(3)), clusterCursor);
+    ASSERT_TRUE(cluster.IsValid());
+    EXPECT_EQ(cluster.path, ConcreteClusterPath(kMockEndpoint3, MockClusterId(4)));
+    cluster = model.NextServerClusterWithCursor(ConcreteClusterPath(kMockEndpoint2, MockClusterId(2)), clusterCursor);
+    ASSERT_TRUE(cluster.IsValid());
+    EXPECT_EQ(cluster.path, ConcreteClusterPath(kMockEndpoint2, MockClusterId(3)));
+    EXPECT_FALSE(model.NextServerClusterWithCursor(cluster.path, clusterCursor).IsValid());
+
+    MetadataCursor attributeCursor;
+    AttributeEntry attribute =
+        model.FirstAttributeWithCursor(ConcreteClusterPath(kMockEndpoint2, MockClusterId(2)), attributeCursor);
+    ASSERT_TRUE(attribute.IsValid());
+    attribute =
+        model.NextAttributeWithCursor(ConcreteAttributePath(kMockEndpoint3, MockClusterId(2), MockAttributeId(2)), attributeCursor);
+    ASSERT_TRUE(attribute.IsValid());
+    EXPECT_EQ(attribute.path, ConcreteAttributePath(kMockEndpoint3, MockClusterId(2), MockAttributeId(3)));
+    EXPECT_FALSE(
+        model.NextAttributeWithCursor(ConcreteAttributePath(kMockEndpoint2, MockClusterId(2), MockAttributeId(2)), attributeCursor)
+            .IsValid());
+}
+
 TEST(TestCodegenModelViaMocks, GetAttributeInfo)
 {
     UseMockNodeConfig config(gTestNodeConfig);
@@ -1695,6 +1805,131 @@ TEST(TestCodegenModelViaMocks, EmberAttributeReadNullOctetString)
     ASSERT_TRUE(actual.IsNull());
 }
 
+namespace {
+
+uint32_t ReadUint32Attribute(CodegenDataModelProvider & model, const ConcreteAttributePath & path)
+{
+    ReadOperation testRequest(path);
+    testRequest.SetSubjectDescriptor(kAdminSubjectDescriptor);
+
+    std::unique_ptr<AttributeValueEncoder> encoder = testRequest.StartEncoding();
+    EXPECT_EQ(model.ReadAttribute(testRequest.GetRequest(), *encoder), CHIP_NO_ERROR);
+    EXPECT_EQ(testRequest.FinishEncoding(), CHIP_NO_ERROR);
+
+    std::vector<DecodedAttributeData> attribute_data;
+    EXPECT_EQ(testRequest.GetEncodedIBs().Decode(attribute_data), CHIP_NO_ERROR);
+    EXPECT_EQ(attribute_data.size(), 1u);
+    VerifyOrReturnValue(attribute_data.size() == 1u, 0);
+
+    uint32_t value = 0;
+    EXPECT_EQ(chip::app::DataModel::Decode(attribute_data[0].dataReader, value), CHIP_NO_ERROR);
+    return value;
+}
+
+void SetEmberUint32(uint32_t value)
+{
+    chip::Test::SetEmberReadOutput(ByteSpan(reinterpret_cast<const uint8_t *>(&value), sizeof(value)));
+}
+
+} // namespace
+
+TEST(TestCodegenModelViaMocks, EmberAttributeReadFromSnapshotCache)
+{
+    UseMockNodeConfig config(gTestNodeConfig);
+    CodegenDataModelProviderWithContext model;
+    ScopedMockAccessControl accessControl;
+    AttributeSnapshotCacheWithStorage<4> cache;
+
+    const ConcreteAttributePath kPath(kMockEndpoint3, MockClusterId(4),
+                                      MOCK_ATTRIBUTE_ID_FOR_NON_NULLABLE_TYPE(ZCL_INT32U_ATTRIBUTE_TYPE));
+
+    model.SetAttributeSnapshotCache(&cache);
+
+    SetEmberUint32(0x1234);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x1234u);
+    EXPECT_EQ(cache.GetHitCount(), 0u);
+
+    // Ember storage is not read again while the data version is unchanged. Changing
+    // the mock storage directly demonstrates that.
+    SetEmberUint32(0x5678);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x1234u);
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+
+    // A data version change invalidates the cached value
+    model.Temporary_ReportAttributeChanged(AttributePathParams(kPath.mEndpointId, kPath.mClusterId, kPath.mAttributeId));
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x5678u);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x5678u);
+    EXPECT_EQ(cache.GetHitCount(), 2u);
+
+    // Metadata changes invalidate everything
+    SetEmberUint32(0x9ABC);
+    chip::Test::SetMockNodeConfig(gTestNodeConfig);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x9ABCu);
+
+    // Values of clusters that have an AttributeAccessInterface are never cached, even when
+    // the AttributeAccessInterface does not handle the attribute.
+    {
+        RegisteredAttributeAccessInterface<UnsupportedReadAccessInterface> aai(ConcreteAttributePath(
+            kMockEndpoint3, MockClusterId(4), MOCK_ATTRIBUTE_ID_FOR_NON_NULLABLE_TYPE(ZCL_INT8U_ATTRIBUTE_TYPE)));
+        SetEmberUint32(0xDEF0);
+        ASSERT_EQ(ReadUint32Attribute(model, kPath), 0xDEF0u);
+        SetEmberUint32(0x0FED);
+        ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x0FEDu);
+    }
+
+    model.SetAttributeSnapshotCache(nullptr);
+    SetEmberUint32(0x1111);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath), 0x1111u);
+
+    // reset things to success to not affect other tests
+    chip::Test::SetEmberReadOutput(ByteSpan());
+}
+
+// clang-format off
+const MockNodeConfig gSingletonNodeConfig({
+    MockEndpointConfig(kMockEndpoint1, {
+        MockClusterConfig(MockClusterId(1), {
+            MockAttributeConfig(MockAttributeId(1), ZCL_INT32U_ATTRIBUTE_TYPE, ATTRIBUTE_MASK_WRITABLE | ATTRIBUTE_MASK_SINGLETON),
+        }),
+    }),
+    MockEndpointConfig(kMockEndpoint2, {
+        MockClusterConfig(MockClusterId(1), {
+            MockAttributeConfig(MockAttributeId(1), ZCL_INT32U_ATTRIBUTE_TYPE, ATTRIBUTE_MASK_WRITABLE | ATTRIBUTE_MASK_SINGLETON),
+        }),
+    }),
+});
+// clang-format on
+
+TEST(TestCodegenModelViaMocks, EmberSingletonAttributeNotInSnapshotCache)
+{
+    UseMockNodeConfig config(gSingletonNodeConfig);
+    CodegenDataModelProviderWithContext model;
+    ScopedMockAccessControl accessControl;
+    AttributeSnapshotCacheWithStorage<4> cache;
+
+    const ConcreteAttributePath kPath1(kMockEndpoint1, MockClusterId(1), MockAttributeId(1));
+    const ConcreteAttributePath kPath2(kMockEndpoint2, MockClusterId(1), MockAttributeId(1));
+
+    model.SetAttributeSnapshotCache(&cache);
+
+    SetEmberUint32(0x1234);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath1), 0x1234u);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath2), 0x1234u);
+
+    // A write through the first endpoint changes the storage shared with the second one, but only bumps
+    // the data version of the first one. The mock ember storage is shared by all paths, like a singleton.
+    SetEmberUint32(0x5678);
+    model.Temporary_ReportAttributeChanged(AttributePathParams(kPath1.mEndpointId, kPath1.mClusterId, kPath1.mAttributeId));
+    ASSERT_EQ(ReadUint32Attribute(model, kPath1), 0x5678u);
+    ASSERT_EQ(ReadUint32Attribute(model, kPath2), 0x5678u);
+    EXPECT_EQ(cache.GetHitCount(), 0u);
+
+    model.SetAttributeSnapshotCache(nullptr);
+
+    // reset things to success to not affect other tests
+    chip::Test::SetEmberReadOutput(ByteSpan());
+}
+
 TEST(TestCodegenModelViaMocks, EmberAttributeReadOctetString)
 {
     UseMockNodeConfig config(gTestNodeConfig);
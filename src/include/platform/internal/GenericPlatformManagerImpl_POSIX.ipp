@@ -33,6 +33,7 @@
 #include <platform/internal/GenericPlatformManagerImpl.ipp>
 
 #include <system/SystemError.h>
+#include <system/SystemEventLoopStats.h>
 #include <system/SystemLayer.h>
 
 #include <assert.h>
@@ -182,6 +183,14 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
     while (!mChipEventQueue.Empty())
     {
         const ChipDeviceEvent event = mChipEventQueue.PopFront();
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+        // Work scheduled through the platform manager is accounted per work function, other events per event type.
+        const void * callback = (event.Type == DeviceEventType::kCallWorkFunct)
+            ? reinterpret_cast<const void *>(event.CallWorkFunct.WorkFunct)
+            : reinterpret_cast<const void *>(static_cast<uintptr_t>(event.Type));
+        System::EventLoopStats::CallbackScope scope(System::GetEventLoopStats(), System::EventLoopStats::CallbackType::kDeviceEvent,
+                                                    callback);
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
         Impl()->DispatchEvent(&event);
     }
 }
@@ -41,6 +41,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -67,6 +68,13 @@
 namespace chip {
 namespace Inet {
 
+namespace {
+
+// The largest number of send queue buffers handed to a single sendmsg() call.
+constexpr size_t kMaxSendIOVCount = 16;
+
+} // namespace
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -485,9 +493,26 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Write as many of the queued buffers as possible with a single system call, rather than one per buffer: a large
+        // message, or several messages queued while the socket was not writable, then go out in as few TCP segments as possible.
+        struct iovec sendIOV[kMaxSendIOVCount];
+        size_t sendIOVCount = 0;
+        size_t bufLen       = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && sendIOVCount < kMaxSendIOVCount;
+             buf.Advance())
+        {
+            sendIOV[sendIOVCount].iov_base = buf->Start();
+            sendIOV[sendIOVCount].iov_len  = buf->DataLength();
+            bufLen += buf->DataLength();
+            sendIOVCount++;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(sendIOVCount);
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -509,21 +534,20 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were entirely sent, including empty ones.
+        mSendQueue.Consume(lenSent);
+        while (lenSent == bufLen && !mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            mSendQueue.FreeHead();
         }
-        else
+
+        if (mSendQueue.IsNull())
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
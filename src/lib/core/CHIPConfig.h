@@ -747,6 +747,41 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of CA certificate signatures that the fabric table remembers as verified.  The ICAC (or
+ *    RCAC) that signed a peer's NOC is the same for every peer on a fabric: with this cache, only the
+ *    signature of the NOC itself is verified on each CASE handshake.  Each entry takes 36 bytes.
+ *    Set to 0 to verify every signature every time.
+ */
+#ifndef CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE (2 * CHIP_CONFIG_MAX_FABRICS)
+#else
+#define CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_CERT_SIGNATURE_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS
+ *
+ *  @brief
+ *    Number of hash slots (a power of 2) of the endpoint/cluster indexes of the AttributeAccessInterface
+ *    and CommandHandlerInterface registries.  Each index handles up to half as many registered interfaces;
+ *    registries with more interfaces, or built with this set to 0, search their whole list on every
+ *    lookup.  The slots are stored inline: each slot takes 16 bytes on 64-bit platforms, so with the
+ *    default of 1024 slots each registry reserves 16 KiB (1024 x 16 B) whether or not it is used.
+ */
+#ifndef CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS 1024
+#else
+#define CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_INTERFACE_REGISTRY_INDEX_SLOTS
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -791,6 +826,19 @@
 #define CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS 2
 #endif // CHIP_CONFIG_MAX_GROUP_CONTROL_PEER
 
+/**
+ *  @def CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+ *
+ *  @brief
+ *   When enabled, the message counters of group peers are found through a hash index instead of
+ *   scanning the peers of their fabric for every group message.  The index takes RAM proportional to
+ *   CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_MAX_GROUP_DATA_PEERS, so it is only enabled by default on
+ *   platforms whose object pools are heap-allocated.
+ */
+#ifndef CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+#define CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+
 /**
  *  @def CHIP_CONFIG_SLOW_CRYPTO
  *
@@ -1107,6 +1155,40 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+ *
+ * @brief Defines the number of (group, epoch key) pairs that GroupDataProviderImpl can index by session id.
+ *
+ * The index lets an incoming group message go straight to the keys whose hash matches its session id,
+ * instead of loading every group key mapping of every fabric from storage.  If there are more pairs than
+ * this, or if set to 0, candidate keys are searched in storage.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE 256
+#else
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+
+/**
+ * @def CHIP_CONFIG_GROUP_KEY_CACHE_SIZE
+ *
+ * @brief Defines the number of keysets whose operational credentials GroupDataProviderImpl keeps in memory.
+ *
+ * Loading a keyset from storage also derives the privacy key of each of its epoch keys.  The most recently
+ * used keysets are cached, so that sending or receiving a group message does not have to do either.  The
+ * cache is flushed whenever a keyset is written or removed.  Set to 0 to always load keysets from storage.
+ */
+#ifndef CHIP_CONFIG_GROUP_KEY_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_KEY_CACHE_SIZE 8
+#else
+#define CHIP_CONFIG_GROUP_KEY_CACHE_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_GROUP_KEY_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1237,6 +1319,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+ *
+ * @brief
+ *   Whether DefaultSessionResumptionStorage keeps its index and the resumption records it points to in
+ *   memory, so that looking up a record by resumption id or by peer does not have to read storage.  Writes
+ *   still go to storage straight away.  This costs about 100 bytes of RAM per resumable session.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+#define CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
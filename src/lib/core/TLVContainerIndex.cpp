@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/TLVContainerIndex.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVTags.h>
+#include <lib/core/TLVTypes.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace TLV {
+
+CHIP_ERROR TLVContainerIndexBase::Build(const TLVReader & containerReader)
+{
+    mCount = 0;
+    VerifyOrReturnError(TLVTypeIsContainer(containerReader.GetType()), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLVReader reader;
+    TLVType outerContainerType;
+    reader.Init(containerReader);
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+    mContainerReader.Init(reader);
+
+    const uint8_t * const bufEnd = reader.mBufEnd;
+    size_t count                 = 0;
+
+    while (true)
+    {
+        // Equivalent to reader.Next(), split up so that the offset of the member can be recorded.
+        ReturnErrorOnFailure(reader.Skip());
+        const uint32_t offset = reader.mLenRead;
+        ReturnErrorOnFailure(reader.ReadElement());
+
+        // Find() repositions readers by offset within the buffer, so the backing store must not have
+        // moved on to another one.
+        VerifyOrReturnError(reader.mBufEnd == bufEnd, CHIP_ERROR_INCORRECT_STATE);
+
+        if (reader.ElementType() == TLVElementType::EndOfContainer)
+        {
+            break;
+        }
+
+        VerifyOrReturnError(count < mCapacity, CHIP_ERROR_NO_MEMORY);
+        mEntries[count++] = { reader.GetTag(), offset };
+    }
+
+    mCount = count;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVContainerIndexBase::Find(Tag tag, TLVReader & result) const
+{
+    const Entry * entry = Lookup(tag);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    result.Init(mContainerReader);
+    result.mReadPoint += entry->offset - mContainerReader.mLenRead;
+    result.mLenRead = entry->offset;
+    return result.ReadElement();
+}
+
+const TLVContainerIndexBase::Entry * TLVContainerIndexBase::Lookup(Tag tag) const
+{
+    if (IsContextTag(tag))
+    {
+        const uint32_t position = TagNumFromTag(tag);
+        if (position < mCount && mEntries[position].tag == tag)
+        {
+            return &mEntries[position];
+        }
+    }
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mEntries[i].tag == tag)
+        {
+            return &mEntries[i];
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVTags.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * Records the position of every direct member of a TLV container in a single pass, so that
+ * individual members can then be located by tag without re-scanning the container.
+ *
+ * Lookups of context tag N first check the N-th member, which is where encoders that write
+ * struct fields in field-id order put it, making the common case a single comparison.  Other
+ * tags fall back to a scan of the (small) index rather than of the TLV encoding.
+ *
+ * The container must lie entirely within the reader's current buffer (always the case for
+ * readers over a single contiguous buffer or a single PacketBuffer) and that buffer must outlive
+ * the index.
+ *
+ * Use TLVContainerIndex<N> to provide the storage.
+ */
+class TLVContainerIndexBase
+{
+public:
+    TLVContainerIndexBase(const TLVContainerIndexBase &)             = delete;
+    TLVContainerIndexBase & operator=(const TLVContainerIndexBase &) = delete;
+
+    /**
+     * Index the members of the container that @p containerReader is positioned on.  The reader
+     * itself is not moved.
+     *
+     * @retval #CHIP_NO_ERROR               On success.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE   If the reader is not positioned on a container.
+     * @retval #CHIP_ERROR_NO_MEMORY        If the container has more members than the index can hold.
+     * @retval #CHIP_ERROR_INCORRECT_STATE  If the container spans more than one buffer.
+     * @retval other                        Errors encountered while parsing the container.
+     */
+    CHIP_ERROR Build(const TLVReader & containerReader);
+
+    /**
+     * Position @p result on the member of the indexed container with tag @p tag.  The result
+     * reader behaves as if it had reached that member by iterating the container, so Next() moves
+     * on to the following member.  If several members share the tag (only valid in lists), which
+     * one is returned is unspecified.
+     *
+     * @retval #CHIP_NO_ERROR                  On success.
+     * @retval #CHIP_ERROR_TLV_TAG_NOT_FOUND   If no member has the given tag, or the index has not been built.
+     */
+    CHIP_ERROR Find(Tag tag, TLVReader & result) const;
+
+    /**
+     * Number of members in the indexed container.
+     */
+    size_t Count() const { return mCount; }
+
+    void Clear() { mCount = 0; }
+
+protected:
+    struct Entry
+    {
+        Tag tag;
+        // Value of the reader's GetLengthRead() at the member's control byte.
+        uint32_t offset;
+    };
+
+    TLVContainerIndexBase(Entry * entries, size_t capacity) : mEntries(entries), mCapacity(capacity) {}
+
+private:
+    const Entry * Lookup(Tag tag) const;
+
+    Entry * mEntries;
+    size_t mCapacity;
+    size_t mCount = 0;
+    // Reader positioned just inside the indexed container, before its first member.
+    TLVReader mContainerReader;
+};
+
+template <size_t N>
+class TLVContainerIndex : public TLVContainerIndexBase
+{
+public:
+    TLVContainerIndex() : TLVContainerIndexBase(mStorage, N) {}
+
+private:
+    Entry mStorage[N];
+};
+
+} // namespace TLV
+} // namespace chip
@@ -17,6 +17,7 @@
  */
 #include <lib/core/TLVReader.h>
 
+#include <array>
 #include <stdint.h>
 #include <string.h>
 
@@ -47,7 +48,39 @@ namespace TLV {
 
 using namespace chip::Encoding;
 
-static const uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+static constexpr uint8_t sTagSizes[] = { 0, 1, 2, 4, 2, 4, 6, 8 };
+
+namespace {
+
+/**
+ * Build a table, indexed by control byte, of the number of bytes in an element's head: the
+ * control byte, the tag bytes and the length/value bytes.  A zero entry marks a control byte
+ * that does not encode a valid element type.
+ */
+constexpr std::array<uint8_t, 256> MakeElementHeadSizes()
+{
+    std::array<uint8_t, 256> headSizes{};
+    for (size_t controlByte = 0; controlByte < headSizes.size(); controlByte++)
+    {
+        const auto elemType = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+        if (!IsValidTLVType(elemType))
+        {
+            continue;
+        }
+        headSizes[controlByte] = static_cast<uint8_t>(1 + sTagSizes[controlByte >> kTLVTagControlShift] +
+                                                      TLVFieldSizeToBytes(GetTLVFieldSize(elemType)));
+    }
+    return headSizes;
+}
+
+constexpr std::array<uint8_t, 256> sElementHeadSizes = MakeElementHeadSizes();
+
+static_assert(sElementHeadSizes[0x18] == 1, "EndOfContainer is a lone control byte");
+static_assert(sElementHeadSizes[0x35] == 2, "Context-tagged structure has a 1-byte tag");
+static_assert(sElementHeadSizes[0xEF] == 17, "Fully-qualified 8-byte tag with 8-byte length is the largest head");
+static_assert(sElementHeadSizes[0x19] == 0, "Reserved element types are flagged as invalid");
+
+} // namespace
 
 TLVReader::TLVReader() :
     ImplicitProfileId(kProfileIdNotSpecified), AppData(nullptr), mElemLenOrVal(0), mBackingStore(nullptr), mReadPoint(nullptr),
@@ -732,12 +765,101 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
         if (err != CHIP_NO_ERROR)
             return err;
 
+        SkipBufferedElements(nestLevel, outerContainerType);
+
         err = ReadElement();
         if (err != CHIP_NO_ERROR)
             return err;
     }
 }
 
+/**
+ * Fast path for SkipToEndOfContainer(): walk the raw encoding of the elements that lie entirely
+ * within the current input buffer, tracking container nesting straight from the control bytes
+ * instead of decoding every element into the reader state.
+ *
+ * The scan stops at an element boundary as soon as it reaches the end of the container being
+ * skipped, the end of the current buffer, or any element that would not pass the checks in
+ * ReadElement()/VerifyElement().  The element-at-a-time path then resumes from that point, so
+ * buffer chaining and error reporting are unchanged.
+ */
+void TLVReader::SkipBufferedElements(uint32_t & nestLevel, TLVType outerContainerType)
+{
+    const uint8_t * p         = mReadPoint;
+    const uint32_t bufLen     = static_cast<uint32_t>(mBufEnd - mReadPoint);
+    const uint8_t * const end = mReadPoint + std::min(bufLen, mMaxLen - mLenRead);
+
+    while (p < end)
+    {
+        const uint8_t controlByte = *p;
+        const uint8_t headBytes   = sElementHeadSizes[controlByte];
+        if (headBytes == 0 || headBytes > end - p)
+        {
+            break;
+        }
+
+        const auto elemType   = static_cast<TLVElementType>(controlByte & kTLVTypeMask);
+        const auto tagControl = static_cast<TLVTagControl>(controlByte & kTLVTagControlMask);
+        const bool anonymous  = (tagControl == TLVTagControl::Anonymous);
+
+        // Mirror the tag checks in VerifyElement(); anything unusual is left for it to report.
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            if (!anonymous || nestLevel == 0)
+            {
+                break;
+            }
+        }
+        else
+        {
+            const bool implicitTag =
+                (tagControl == TLVTagControl::ImplicitProfile_2Bytes) || (tagControl == TLVTagControl::ImplicitProfile_4Bytes);
+            if (implicitTag && ImplicitProfileId == kProfileIdNotSpecified)
+            {
+                break;
+            }
+
+            const bool tagAllowed = (mContainerType == kTLVType_Structure && !anonymous) ||
+                (mContainerType == kTLVType_Array && anonymous) || (mContainerType == kTLVType_List) ||
+                (mContainerType == kTLVType_UnknownContainer) ||
+                (mContainerType == kTLVType_NotSpecified && tagControl != TLVTagControl::ContextSpecific);
+            if (!tagAllowed)
+            {
+                break;
+            }
+        }
+
+        uint64_t dataLen = 0;
+        if (TLVTypeHasLength(elemType))
+        {
+            // The length field occupies the trailing bytes of the head.
+            const uint8_t lenBytes = TLVFieldSizeToBytes(GetTLVFieldSize(elemType));
+            memcpy(&dataLen, p + headBytes - lenBytes, lenBytes);
+            LittleEndian::HostSwap(dataLen);
+            if (dataLen > static_cast<uint64_t>(end - p - headBytes))
+            {
+                break;
+            }
+        }
+
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            nestLevel--;
+            mContainerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
+        }
+        else if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+            mContainerType = static_cast<TLVType>(elemType);
+        }
+
+        p += headBytes + static_cast<size_t>(dataLen);
+    }
+
+    mLenRead += static_cast<uint32_t>(p - mReadPoint);
+    mReadPoint = p;
+}
+
 CHIP_ERROR TLVReader::ReadElement()
 {
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
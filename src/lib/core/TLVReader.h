@@ -84,6 +84,7 @@ class DLL_EXPORT TLVReader
 {
     friend class TLVWriter;
     friend class TLVUpdater;
+    friend class TLVContainerIndexBase;
 
 public:
     TLVReader();
@@ -974,6 +975,7 @@ protected:
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
+    void SkipBufferedElements(uint32_t & nestLevel, TLVType outerContainerType);
     CHIP_ERROR VerifyElement();
     Tag ReadTag(TLVTagControl tagControl, const uint8_t *& p) const;
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
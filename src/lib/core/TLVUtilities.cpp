@@ -277,6 +277,10 @@ static CHIP_ERROR FindHandler(const TLVReader & aReader, size_t aDepth, void * a
 /**
  *  Search for the specified tag within the provided TLV reader.
  *
+ *  Each call walks the encoding from the reader's position.  To look up
+ *  several members of the same container, build a TLVContainerIndex for it
+ *  once and use TLVContainerIndex::Find() instead.
+ *
  *  @param[in]   aReader        A read-only reference to the TLV reader in
  *                              which to find the specified tag.
  *  @param[in]   aTag           A read-only reference to the TLV tag to find.
@@ -4922,3 +4922,133 @@ TEST_F(TestTLV, TestUninitializedWriter)
         EXPECT_EQ(writer.CopyContainer(ContextTag(1), buf, static_cast<uint16_t>(sizeof(buf))), CHIP_ERROR_INCORRECT_STATE);
     }
 }
+
+TEST_F(TestTLV, CheckSkipNestedContainers)
+{
+    uint8_t buf[1024];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    TLVType innerContainerType;
+    TLVType listContainerType;
+
+    writer.Init(buf);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(1), kTLVType_Array, innerContainerType), CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        TLVType structContainerType;
+        EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, structContainerType), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.Put(ContextTag(0), i), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.PutString(ContextTag(1), "endpoint label"), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.Put(ContextTag(2), static_cast<uint64_t>(UINT64_MAX - i)), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.EndContainer(structContainerType), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.EndContainer(innerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(2), kTLVType_List, listContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(CommonTag(77), true), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutNull(AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(listContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(3), static_cast<uint32_t>(0xDEADBEEF)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(AnonymousTag(), static_cast<uint8_t>(42)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    const uint32_t encodedLen = writer.GetLengthWritten();
+
+    // Skipping the outermost structure lands on the trailing element.
+    {
+        TLVReader reader;
+        uint8_t value = 0;
+
+        reader.Init(buf, encodedLen);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, 42);
+        EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+        EXPECT_EQ(reader.GetLengthRead(), encodedLen);
+    }
+
+    // Exiting a container part way through lands on the next sibling.
+    {
+        TLVReader reader;
+        uint32_t value = 0;
+
+        reader.Init(buf, encodedLen);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(ContextTag(1)), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.EnterContainer(innerContainerType), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.ExitContainer(innerContainerType), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(ContextTag(2)), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(ContextTag(3)), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, 0xDEADBEEFu);
+        EXPECT_EQ(reader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+    }
+
+    // Truncating the encoding anywhere inside the structure is reported, not skipped over.
+    for (uint32_t len = 1; len < encodedLen - 2; len++)
+    {
+        TLVReader reader;
+
+        reader.Init(buf, len);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_NE(reader.Skip(), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestTLV, CheckSkipMalformedContainers)
+{
+    // Array containing a context-tagged element.
+    {
+        const uint8_t encoding[] = { 0x15, 0x36, 0x01, 0x24, 0x01, 0x05, 0x18, 0x18 };
+        TLVReader reader;
+
+        reader.Init(encoding);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_ERROR_INVALID_TLV_TAG);
+    }
+
+    // Structure containing an anonymous element.
+    {
+        const uint8_t encoding[] = { 0x15, 0x15, 0x04, 0x05, 0x18, 0x18 };
+        TLVReader reader;
+
+        reader.Init(encoding);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_ERROR_INVALID_TLV_TAG);
+    }
+
+    // Implicit profile tag with no implicit profile configured.
+    {
+        const uint8_t encoding[] = { 0x17, 0x84, 0x01, 0x00, 0x05, 0x18 };
+        TLVReader reader;
+
+        reader.Init(encoding);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_ERROR_UNKNOWN_IMPLICIT_TLV_TAG);
+    }
+
+    // Reserved element type.
+    {
+        const uint8_t encoding[] = { 0x17, 0x19, 0x18 };
+        TLVReader reader;
+
+        reader.Init(encoding);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    }
+
+    // Byte string whose length runs past the end of the encoding.
+    {
+        const uint8_t encoding[] = { 0x17, 0x10, 0x20, 0x00, 0x18 };
+        TLVReader reader;
+
+        reader.Init(encoding);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Skip(), CHIP_ERROR_TLV_UNDERRUN);
+    }
+}
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVContainerIndex.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVTags.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint8_t kFieldCount = 40;
+
+// Writes { 0: 0, 1: 100, ..., 39: 3900, 100: "name", 101: { 0: true }, Profile(0x1234, 7): null }
+uint32_t WriteLargeStruct(uint8_t * buf, uint32_t bufLen)
+{
+    TLVWriter writer;
+    TLVType outerContainerType;
+    TLVType innerContainerType;
+
+    writer.Init(buf, bufLen);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < kFieldCount; i++)
+    {
+        EXPECT_EQ(writer.Put(ContextTag(i), static_cast<uint32_t>(i * 100)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.PutString(ContextTag(100), "name"), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(101), kTLVType_Structure, innerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutBoolean(ContextTag(0), true), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(innerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutNull(ProfileTag(0x1234, 7)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    return writer.GetLengthWritten();
+}
+
+} // namespace
+
+TEST(TestTLVContainerIndex, FindsEveryMember)
+{
+    uint8_t buf[512];
+    const uint32_t len = WriteLargeStruct(buf, sizeof(buf));
+
+    TLVReader reader;
+    reader.Init(buf, len);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    TLVContainerIndex<48> index;
+    ASSERT_EQ(index.Build(reader), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), static_cast<size_t>(kFieldCount + 3));
+
+    // Look up in reverse order to make sure nothing depends on iteration order.
+    for (int i = kFieldCount - 1; i >= 0; i--)
+    {
+        TLVReader field;
+        uint32_t value = 0;
+        ASSERT_EQ(index.Find(ContextTag(static_cast<uint8_t>(i)), field), CHIP_NO_ERROR);
+        EXPECT_EQ(field.GetTag(), ContextTag(static_cast<uint8_t>(i)));
+        EXPECT_EQ(field.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, static_cast<uint32_t>(i * 100));
+    }
+
+    {
+        TLVReader field;
+        CharSpan name;
+        ASSERT_EQ(index.Find(ContextTag(100), field), CHIP_NO_ERROR);
+        EXPECT_EQ(field.Get(name), CHIP_NO_ERROR);
+        EXPECT_TRUE(name.data_equal("name"_span));
+    }
+
+    {
+        TLVReader field;
+        TLVType outerContainerType;
+        bool value = false;
+        ASSERT_EQ(index.Find(ContextTag(101), field), CHIP_NO_ERROR);
+        EXPECT_EQ(field.GetType(), kTLVType_Structure);
+        ASSERT_EQ(field.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+        ASSERT_EQ(field.Next(ContextTag(0)), CHIP_NO_ERROR);
+        EXPECT_EQ(field.Get(value), CHIP_NO_ERROR);
+        EXPECT_TRUE(value);
+        EXPECT_EQ(field.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+
+        // Iteration carries on with the following member.
+        EXPECT_EQ(field.Next(ProfileTag(0x1234, 7)), CHIP_NO_ERROR);
+        EXPECT_EQ(field.GetType(), kTLVType_Null);
+        EXPECT_EQ(field.Next(), CHIP_END_OF_TLV);
+    }
+
+    {
+        TLVReader field;
+        EXPECT_EQ(index.Find(ContextTag(41), field), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+        EXPECT_EQ(index.Find(ProfileTag(0x1234, 8), field), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    }
+
+    // Building the index does not move the source reader.
+    EXPECT_EQ(reader.GetType(), kTLVType_Structure);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+TEST(TestTLVContainerIndex, OutOfOrderFields)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(ContextTag(2), static_cast<uint8_t>(2)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(0)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(ContextTag(1), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+    TLVContainerIndex<4> index;
+    ASSERT_EQ(index.Build(reader), CHIP_NO_ERROR);
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        TLVReader field;
+        uint8_t value = 0xFF;
+        ASSERT_EQ(index.Find(ContextTag(i), field), CHIP_NO_ERROR);
+        EXPECT_EQ(field.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(TestTLVContainerIndex, Errors)
+{
+    uint8_t buf[512];
+    const uint32_t len = WriteLargeStruct(buf, sizeof(buf));
+
+    TLVReader reader;
+    reader.Init(buf, len);
+
+    // Not positioned on a container.
+    TLVContainerIndex<48> index;
+    EXPECT_EQ(index.Build(reader), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    // Too many members for the index.
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    TLVContainerIndex<8> smallIndex;
+    EXPECT_EQ(smallIndex.Build(reader), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(smallIndex.Count(), 0u);
+
+    TLVReader field;
+    EXPECT_EQ(smallIndex.Find(ContextTag(0), field), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    // Truncated container.
+    TLVReader truncated;
+    truncated.Init(buf, len - 1);
+    ASSERT_EQ(truncated.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Build(truncated), CHIP_END_OF_TLV);
+}
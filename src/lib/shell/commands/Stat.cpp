@@ -20,6 +20,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/DiagnosticDataProvider.h>
+#include <system/SystemEventLoopStats.h>
 #include <system/SystemStats.h>
 
 #if CHIP_HAVE_CONFIG_H
@@ -65,6 +66,50 @@ CHIP_ERROR StatPeakHandler(int argc, char ** argv)
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+void PrintHistogram(const System::EventLoopStats::Histogram & histogram)
+{
+    using System::EventLoopStats;
+
+    const uint32_t count = histogram.GetCount();
+    streamer_printf(streamer_get(), ": count %u, avg %u us, max %u us, buckets", static_cast<unsigned>(count),
+                    static_cast<unsigned>((count == 0) ? 0 : histogram.GetTotal().count() / count),
+                    static_cast<unsigned>(histogram.GetMax().count()));
+    for (size_t i = 0; i < EventLoopStats::Histogram::kBucketCount; i++)
+    {
+        streamer_printf(streamer_get(), " >=%uus:%u",
+                        static_cast<unsigned>(EventLoopStats::Histogram::GetBucketLowerBound(i).count()),
+                        static_cast<unsigned>(histogram.GetBucketCount(i)));
+    }
+    streamer_printf(streamer_get(), "\r\n");
+}
+
+CHIP_ERROR StatLoopHandler(int argc, char ** argv)
+{
+    using System::EventLoopStats;
+
+    const EventLoopStats & stats = System::GetEventLoopStats();
+    streamer_printf(streamer_get(), "Timer queue wait");
+    PrintHistogram(stats.GetQueueWaitTime());
+
+    for (const auto & callback : stats.GetCallbacks())
+    {
+        if (callback.callback == nullptr)
+        {
+            streamer_printf(streamer_get(), "Other callbacks");
+        }
+        else
+        {
+            streamer_printf(streamer_get(), "Callback %p (%s)", callback.callback,
+                            EventLoopStats::GetCallbackTypeName(callback.type));
+        }
+        PrintHistogram(callback.runTime);
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
 CHIP_ERROR StatResetHandler(int argc, char ** argv)
 {
     auto current    = System::Stats::GetResourcesInUse();
@@ -84,6 +129,10 @@ CHIP_ERROR StatResetHandler(int argc, char ** argv)
     mbedtls_memory_buffer_alloc_max_reset();
 #endif
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+    System::GetEventLoopStats().Reset();
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
     return CHIP_NO_ERROR;
 }
 
@@ -93,7 +142,10 @@ void RegisterStatCommands()
 {
     static constexpr Command subCommands[] = {
         { &StatPeakHandler, "peak", "Print peak usage of system resources" },
-        { &StatResetHandler, "reset", "Reset peak usage of system resources" },
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+        { &StatLoopHandler, "loop", "Print run and queue wait times of the event loop callbacks" },
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+        { &StatResetHandler, "reset", "Reset peak usage of system resources and event loop statistics" },
     };
 
     static constexpr Command statCommand = { &SubShellCommand<ArraySize(subCommands), subCommands>, "stat", "Statistics commands" };
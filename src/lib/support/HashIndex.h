@@ -0,0 +1,172 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a fixed-size hash index over objects stored elsewhere, such as in an ObjectPool.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * A fixed-size, open-addressing (linear probing) hash index mapping 32-bit keys to objects that are
+ * owned elsewhere, typically by an ObjectPool that would otherwise have to be scanned to find an object.
+ *
+ * Several objects may share a key: Find() takes a predicate to select among them.
+ *
+ * The index holds up to N objects, with a load factor of at most 1/2.  Objects added beyond that are
+ * only counted, and IsComplete() returns false until enough objects have been removed: in the meantime,
+ * a failed Find() does not mean that there is no matching object, and callers have to fall back to a
+ * search of the owner.  This keeps the index correct when the owner is a heap pool whose size is not
+ * actually bounded by N.
+ */
+template <typename T, size_t N>
+class HashIndex
+{
+public:
+    HashIndex() { Clear(); }
+
+    HashIndex(const HashIndex &)             = delete;
+    HashIndex & operator=(const HashIndex &) = delete;
+
+    /**
+     * Adds aValue under aKey.  Adding an object that is already in the index is not allowed.
+     */
+    void Add(uint32_t aKey, T * aValue)
+    {
+        if (mCount >= N)
+        {
+            mNumOverflowed++;
+            return;
+        }
+
+        size_t slot = Home(aKey);
+        while (mSlots[slot].value != nullptr)
+        {
+            slot = (slot + 1) & kMask;
+        }
+        mSlots[slot].key   = aKey;
+        mSlots[slot].value = aValue;
+        mCount++;
+    }
+
+    /**
+     * Removes aValue, which has to have been added under aKey.
+     */
+    void Remove(uint32_t aKey, T * aValue)
+    {
+        size_t slot = Home(aKey);
+        while (mSlots[slot].value != aValue)
+        {
+            if (mSlots[slot].value == nullptr)
+            {
+                // Not indexed, so it has to be one of the objects that did not fit.
+                if (mNumOverflowed > 0)
+                {
+                    mNumOverflowed--;
+                }
+                return;
+            }
+            slot = (slot + 1) & kMask;
+        }
+
+        // Backward-shift deletion: move up any later entry of the probe run that the hole would otherwise
+        // make unreachable, so that lookups can still stop at the first empty slot.
+        size_t hole = slot;
+        for (size_t next = (hole + 1) & kMask; mSlots[next].value != nullptr; next = (next + 1) & kMask)
+        {
+            const size_t home = Home(mSlots[next].key);
+            if (((next - home) & kMask) >= ((next - hole) & kMask))
+            {
+                mSlots[hole] = mSlots[next];
+                hole         = next;
+            }
+        }
+        mSlots[hole].value = nullptr;
+        mCount--;
+    }
+
+    /**
+     * Returns the first object added under aKey for which aPredicate(object) returns true, or nullptr.
+     */
+    template <typename Predicate>
+    T * Find(uint32_t aKey, Predicate && aPredicate) const
+    {
+        for (size_t slot = Home(aKey); mSlots[slot].value != nullptr; slot = (slot + 1) & kMask)
+        {
+            if (mSlots[slot].key == aKey && aPredicate(mSlots[slot].value))
+            {
+                return mSlots[slot].value;
+            }
+        }
+        return nullptr;
+    }
+
+    T * Find(uint32_t aKey) const
+    {
+        return Find(aKey, [](T *) { return true; });
+    }
+
+    /**
+     * Whether every object added to the index, and not removed since, can be found through it.
+     */
+    bool IsComplete() const { return mNumOverflowed == 0; }
+
+    size_t Count() const { return mCount + mNumOverflowed; }
+
+    void Clear()
+    {
+        for (auto & slot : mSlots)
+        {
+            slot.value = nullptr;
+        }
+        mCount         = 0;
+        mNumOverflowed = 0;
+    }
+
+private:
+    static constexpr size_t Log2Capacity(size_t count, size_t log2 = 1)
+    {
+        return ((static_cast<size_t>(1) << log2) >= 2 * count) ? log2 : Log2Capacity(count, log2 + 1);
+    }
+
+    static constexpr size_t kLog2Capacity = Log2Capacity(N);
+    static constexpr size_t kCapacity     = static_cast<size_t>(1) << kLog2Capacity;
+    static constexpr size_t kMask         = kCapacity - 1;
+
+    static_assert(N > 0, "A HashIndex has to be able to hold at least one object");
+    static_assert(kLog2Capacity < 32, "HashIndex is too large");
+
+    // Fibonacci hashing: keys that only differ in their low bits (e.g. consecutive ids) spread out well.
+    static size_t Home(uint32_t aKey) { return static_cast<size_t>((aKey * UINT32_C(2654435769)) >> (32 - kLog2Capacity)); }
+
+    struct Slot
+    {
+        T * value;
+        uint32_t key;
+    };
+
+    Slot mSlots[kCapacity];
+    size_t mCount         = 0;
+    size_t mNumOverflowed = 0;
+};
+
+} // namespace chip
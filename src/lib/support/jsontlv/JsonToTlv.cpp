@@ -28,6 +28,7 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
+#include <system/TLVArenaBackingStore.h>
 
 namespace chip {
 
@@ -409,6 +410,19 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR JsonToTlv(const std::string & jsonString, Platform::ScopedMemoryBufferWithSize<uint8_t> & tlv)
+{
+    // Encode into a growable arena first, so the output buffer can be allocated to the exact size.
+    System::ArenaTLVWriter writer;
+    ReturnErrorOnFailure(writer.Init());
+    writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+    ReturnErrorOnFailure(JsonToTlv(jsonString, writer));
+
+    VerifyOrReturnError(tlv.Alloc(writer.GetLengthWritten()), CHIP_ERROR_NO_MEMORY);
+    MutableByteSpan tlvSpan(tlv.Get(), tlv.AllocatedSize());
+    return writer.Finalize(tlvSpan);
+}
+
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
 {
     Json::Reader reader;
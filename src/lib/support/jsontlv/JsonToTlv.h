@@ -16,6 +16,7 @@
  */
 
 #include <lib/core/TLV.h>
+#include <lib/support/ScopedBuffer.h>
 #include <string>
 
 namespace chip {
@@ -26,6 +27,12 @@ namespace chip {
  */
 CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv);
 
+/*
+ * Given a JSON object that represents TLV, this function writes the corresponding TLV bytes into a newly allocated buffer
+ * sized to fit the data, so callers do not need to guess the size of the encoding up front.
+ */
+CHIP_ERROR JsonToTlv(const std::string & jsonString, Platform::ScopedMemoryBufferWithSize<uint8_t> & tlv);
+
 /*
  * Given a JSON object that represents TLV, this function makes encode calls on the given TLVWriter to encode the corresponding TLV
  * bytes.
@@ -15,11 +15,17 @@
  *    limitations under the License.
  */
 
-#include "lib/support/CHIPMemString.h"
-#include "lib/support/ScopedBuffer.h"
-#include <json/json.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/TlvToJson.h>
@@ -35,6 +41,18 @@ namespace {
 // and this value is never stored.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
+// The JSON is laid out the way Json::StyledWriter lays out the equivalent Json::Value, which is
+// what this converter used to go through: 3 space indentation, and arrays of scalars kept on a
+// single line if they fit within the right margin.
+constexpr size_t kIndentSize  = 3;
+constexpr size_t kRightMargin = 74;
+
+// An array with this many elements is never put on a single line.
+constexpr size_t kMaxSingleLineArraySize = (kRightMargin + kIndentSize - 1) / kIndentSize;
+
+// Longest JSON element name: a 10 digit tag number, ':', and two type names joined by '-'.
+constexpr size_t kMaxJsonElementNameLength = 24;
+
 /// RAII to switch the implicit profile id for a reader
 class ImplicitProfileIdChange
 {
@@ -77,94 +95,346 @@ const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
     }
 };
 
+ElementTypeContext GetElementTypeContext(TLV::TLVReader & reader)
+{
+    ElementTypeContext type;
+    type.tlvType = reader.GetType();
+    if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        type.isDouble = reader.IsElementDouble();
+    }
+    return type;
+}
+
+void AppendUnsigned(std::string & out, uint64_t value)
+{
+    char digits[20];
+    size_t count = 0;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (count > 0)
+    {
+        out += digits[--count];
+    }
+}
+
+void AppendSigned(std::string & out, int64_t value)
+{
+    if (value < 0)
+    {
+        out += '-';
+        // Negate in unsigned arithmetic so that INT64_MIN does not overflow.
+        AppendUnsigned(out, ~static_cast<uint64_t>(value) + 1);
+        return;
+    }
+    AppendUnsigned(out, static_cast<uint64_t>(value));
+}
+
+void AppendDouble(std::string & out, double value)
+{
+    if (std::isnan(value))
+    {
+        out += "null";
+        return;
+    }
+
+    // Enough for any "%.17g" output of a finite double.
+    char buffer[32];
+    int len = snprintf(buffer, sizeof(buffer), "%.*g", std::numeric_limits<double>::max_digits10, value);
+    VerifyOrReturn(len > 0 && static_cast<size_t>(len) < sizeof(buffer));
+
+    bool isIntegral = true;
+    for (int i = 0; i < len; i++)
+    {
+        // Some locales use ',' as the decimal separator.
+        if (buffer[i] == ',')
+        {
+            buffer[i] = '.';
+        }
+        if (buffer[i] == '.' || buffer[i] == 'e')
+        {
+            isIntegral = false;
+        }
+    }
+
+    out.append(buffer, static_cast<size_t>(len));
+    if (isIntegral)
+    {
+        // Keep the value recognizable as a floating point number.
+        out += ".0";
+    }
+}
+
+void AppendUnicodeEscape(std::string & out, uint32_t codeUnit)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    out += "\\u";
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        out += kHexDigits[(codeUnit >> shift) & 0xF];
+    }
+}
+
 /*
- * Encapsulates the element information required to construct a JSON element name string in a JSON object.
+ * Decodes the UTF-8 sequence starting at `str`, advancing `str` to its last byte.
  *
- * The generated JSON element name string is constructed as:
- *     'TagNumber:ElementType-SubElementType'.
+ * Invalid sequences decode as U+FFFD, exactly like the Json::StyledWriter string escaping.
  */
-struct JsonObjectElementContext
+uint32_t DecodeUtf8(const uint8_t *& str, const uint8_t * end)
 {
-    JsonObjectElementContext(TLV::TLVReader & reader)
+    constexpr uint32_t kReplacementCharacter = 0xFFFD;
+
+    const uint32_t firstByte = str[0];
+    const size_t available   = static_cast<size_t>(end - str);
+
+    if (firstByte < 0x80)
     {
-        tag               = reader.GetTag();
-        implicitProfileId = reader.ImplicitProfileId;
-        type.tlvType      = reader.GetType();
-        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        VerifyOrReturnValue(available >= 2, kReplacementCharacter);
+        const uint32_t codePoint = ((firstByte & 0x1F) << 6) | (str[1] & 0x3Fu);
+        str += 1;
+        return (codePoint < 0x80) ? kReplacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        VerifyOrReturnValue(available >= 3, kReplacementCharacter);
+        const uint32_t codePoint = ((firstByte & 0x0F) << 12) | ((str[1] & 0x3Fu) << 6) | (str[2] & 0x3Fu);
+        str += 2;
+        VerifyOrReturnValue(codePoint < 0xD800 || codePoint > 0xDFFF, kReplacementCharacter);
+        return (codePoint < 0x800) ? kReplacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        VerifyOrReturnValue(available >= 4, kReplacementCharacter);
+        const uint32_t codePoint =
+            ((firstByte & 0x07) << 18) | ((str[1] & 0x3Fu) << 12) | ((str[2] & 0x3Fu) << 6) | (str[3] & 0x3Fu);
+        str += 3;
+        return (codePoint < 0x10000) ? kReplacementCharacter : codePoint;
+    }
+
+    return kReplacementCharacter;
+}
+
+/*
+ * Appends a quoted JSON string.  Control characters and all non-ASCII characters are escaped, so
+ * the output is plain ASCII.
+ */
+void AppendQuotedString(std::string & out, const char * data, size_t length)
+{
+    const auto * str = reinterpret_cast<const uint8_t *>(data);
+    const auto * end = str + length;
+
+    out += '"';
+
+    // Copy runs of characters that need no escaping in one go.
+    const uint8_t * run = str;
+    for (; str != end; ++str)
+    {
+        const uint8_t c = *str;
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
         {
-            type.isDouble = reader.IsElementDouble();
+            continue;
         }
+
+        out.append(reinterpret_cast<const char *>(run), static_cast<size_t>(str - run));
+
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default: {
+            uint32_t codePoint = DecodeUtf8(str, end);
+            if (codePoint < 0x10000)
+            {
+                AppendUnicodeEscape(out, codePoint);
+            }
+            else
+            {
+                // Encode as a surrogate pair.
+                codePoint -= 0x10000;
+                AppendUnicodeEscape(out, 0xD800 + ((codePoint >> 10) & 0x3FF));
+                AppendUnicodeEscape(out, 0xDC00 + (codePoint & 0x3FF));
+            }
+            break;
+        }
+        }
+
+        run = str + 1;
     }
 
-    std::string GenerateJsonElementName() const
+    out.append(reinterpret_cast<const char *>(run), static_cast<size_t>(end - run));
+    out += '"';
+}
+
+/*
+ * JSON element name for a struct member, constructed as:
+ *     'TagNumber:ElementType-SubElementType'.
+ */
+struct JsonElementName
+{
+    void Generate(TLV::Tag tag, uint32_t implicitProfileId, const ElementTypeContext & type, const ElementTypeContext & subType)
     {
-        std::string str = "???";
+        length = 0;
         if (TLV::IsContextTag(tag))
         {
             // common case for context tags: raw value
-            str = std::to_string(TLV::TagNumFromTag(tag));
+            AppendNumber(TLV::TagNumFromTag(tag));
         }
         else if (TLV::IsProfileTag(tag))
         {
             if (TLV::ProfileIdFromTag(tag) == implicitProfileId)
             {
-                str = std::to_string(TLV::TagNumFromTag(tag));
+                AppendNumber(TLV::TagNumFromTag(tag));
             }
             else
             {
-                uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
-                str                = std::to_string(tagNumber);
+                AppendNumber((static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag));
             }
         }
-        str = str + ":" + GetJsonElementStrFromType(type);
+        else
+        {
+            Append("???");
+        }
+
+        Append(":");
+        Append(GetJsonElementStrFromType(type));
         if (type.tlvType == TLV::kTLVType_Array)
         {
-            str = str + "-" + GetJsonElementStrFromType(subType);
+            Append("-");
+            Append(GetJsonElementStrFromType(subType));
         }
-        return str;
     }
 
-    TLV::Tag tag;
-    uint32_t implicitProfileId;
-    ElementTypeContext type;
-    ElementTypeContext subType;
+    bool operator<(const JsonElementName & other) const
+    {
+        int result = memcmp(value, other.value, std::min(length, other.length));
+        return (result < 0) || (result == 0 && length < other.length);
+    }
+
+    bool operator==(const JsonElementName & other) const
+    {
+        return length == other.length && memcmp(value, other.value, length) == 0;
+    }
+
+    void AppendNumber(uint32_t number)
+    {
+        char digits[10];
+        size_t count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+        } while (number != 0);
+
+        while (count > 0)
+        {
+            value[length++] = digits[--count];
+        }
+    }
+
+    void Append(const char * str)
+    {
+        const size_t len = strlen(str);
+        memcpy(value + length, str, len);
+        length += len;
+    }
+
+    char value[kMaxJsonElementNameLength];
+    size_t length = 0;
 };
 
 /*
- * This templated function inserts a name/value pair into the Json object.
- * The value is templated to be of type T and accepts any of the following types:
+ * Writes the JSON representation of TLV data straight from a TLVReader into a string, without
+ * building a Json::Value tree first.
  *
- *      bool, uint*_t, int*_t, char *, float, double, std::string, Json::Value
- *
- * This method uses the provided element context to generate Json name string.
+ * The members of each TLV structure are converted in encoding order, exactly like they used to be
+ * inserted into the tree, so errors are reported in the same order.  JSON objects list their
+ * members sorted by name, so the text of each member value is then moved into place.  The members
+ * of all the structures being written live in a single vector that is reused for the whole
+ * conversion.
  */
-template <typename T>
-void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+class JsonWriter
 {
-    if (json.isArray())
+public:
+    JsonWriter(std::string & out) : mOut(out) {}
+
+    /*
+     * Given a TLVReader positioned at TLV structure this function:
+     *   - enters structure
+     *   - converts all elements of a structure into JSON object representation
+     *   - exits structure
+     */
+    CHIP_ERROR WriteStruct(TLV::TLVReader & reader);
+
+private:
+    struct Member
     {
-        json.append(val);
-    }
-    else
+        JsonElementName name;
+        size_t index;
+        // Position of the converted value in the output.
+        size_t valueStart;
+        size_t valueEnd;
+    };
+
+    CHIP_ERROR WriteValue(TLV::TLVReader & reader, ElementTypeContext & arraySubType);
+    CHIP_ERROR WriteArray(TLV::TLVReader & reader, ElementTypeContext & subType);
+    CHIP_ERROR WriteByteString(TLV::TLVReader & reader);
+
+    static bool IsNonEmptyStruct(const TLV::TLVReader & reader);
+    void BreakArrayIntoLines(size_t arrayStart, const size_t * elementStarts, size_t count);
+
+    void WriteIndent()
     {
-        json[ctx.GenerateJsonElementName()] = val;
+        mOut += '\n';
+        mOut.append(mIndent, ' ');
     }
-}
 
-static CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj);
+    std::string & mOut;
+    size_t mIndent = 0;
+    std::vector<Member> mMembers;
+    // Converted member values of the structure being laid out.
+    std::string mValues;
+};
 
-/*
- * Given a TLVReader positioned at TLV structure this function:
- *   - enters structure
- *   - converts all elements of a structure into JSON object representation
- *   - exits structure
- */
-CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+CHIP_ERROR JsonWriter::WriteStruct(TLV::TLVReader & reader)
 {
     CHIP_ERROR err;
     TLV::TLVType containerType;
+    const size_t first       = mMembers.size();
+    const size_t valuesStart = mOut.size();
 
     ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    mIndent += kIndentSize;
 
     while ((err = reader.Next()) == CHIP_NO_ERROR)
     {
@@ -177,17 +447,71 @@ CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         }
 
         // Recursively convert to JSON the item within the struct.
-        ReturnErrorOnFailure(TlvToJson(reader, jsonObj));
+        const ElementTypeContext type = GetElementTypeContext(reader);
+        ElementTypeContext subType;
+        const size_t valueStart = mOut.size();
+        ReturnErrorOnFailure(WriteValue(reader, subType));
+
+        // Nested structures have removed their own members by now, so this one goes right after ours.
+        mMembers.emplace_back();
+        Member & member = mMembers.back();
+        member.name.Generate(tag, reader.ImplicitProfileId, type, subType);
+        member.index      = mMembers.size();
+        member.valueStart = valueStart - valuesStart;
+        member.valueEnd   = mOut.size() - valuesStart;
     }
 
     VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    return reader.ExitContainer(containerType);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+    const size_t last = mMembers.size();
+    if (first == last)
+    {
+        mIndent -= kIndentSize;
+        mOut += "{}";
+        return CHIP_NO_ERROR;
+    }
+
+    std::sort(mMembers.begin() + static_cast<std::ptrdiff_t>(first), mMembers.end(), [](const Member & a, const Member & b) {
+        return (a.name < b.name) || (a.name == b.name && a.index < b.index);
+    });
+
+    mValues.assign(mOut, valuesStart, std::string::npos);
+    mOut.resize(valuesStart);
+    mOut += '{';
+
+    bool isFirstMember = true;
+    for (size_t i = first; i < last; i++)
+    {
+        // Like a JSON object, only keep the last of several members with the same name.
+        if (i + 1 < last && mMembers[i].name == mMembers[i + 1].name)
+        {
+            continue;
+        }
+
+        if (!isFirstMember)
+        {
+            mOut += ',';
+        }
+        isFirstMember = false;
+
+        WriteIndent();
+        mOut += '"';
+        mOut.append(mMembers[i].name.value, mMembers[i].name.length);
+        mOut += "\" : ";
+        mOut.append(mValues, mMembers[i].valueStart, mMembers[i].valueEnd - mMembers[i].valueStart);
+    }
+
+    mIndent -= kIndentSize;
+    WriteIndent();
+    mOut += '}';
+
+    mMembers.resize(first);
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+CHIP_ERROR JsonWriter::WriteValue(TLV::TLVReader & reader, ElementTypeContext & arraySubType)
 {
-    JsonObjectElementContext context(reader);
-
     switch (reader.GetType())
     {
     case TLV::kTLVType_UnsignedInteger: {
@@ -195,11 +519,13 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<uint32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            AppendUnsigned(mOut, v);
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            mOut += '"';
+            AppendUnsigned(mOut, v);
+            mOut += '"';
         }
         break;
     }
@@ -209,11 +535,13 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<int32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            AppendSigned(mOut, v);
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            mOut += '"';
+            AppendSigned(mOut, v);
+            mOut += '"';
         }
         break;
     }
@@ -221,7 +549,7 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     case TLV::kTLVType_Boolean: {
         bool v;
         ReturnErrorOnFailure(reader.Get(v));
-        InsertJsonElement(jsonObj, context, v);
+        mOut += v ? "true" : "false";
         break;
     }
 
@@ -230,105 +558,183 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (v == std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
+            AppendQuotedString(mOut, kFloatingPointPositiveInfinity, strlen(kFloatingPointPositiveInfinity));
         }
         else if (v == -std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
+            AppendQuotedString(mOut, kFloatingPointNegativeInfinity, strlen(kFloatingPointNegativeInfinity));
         }
         else
         {
-            InsertJsonElement(jsonObj, context, v);
+            AppendDouble(mOut, v);
         }
         break;
     }
 
-    case TLV::kTLVType_ByteString: {
-        ByteSpan span;
-        ReturnErrorOnFailure(reader.Get(span));
-
-        Platform::ScopedMemoryBuffer<char> byteString;
-        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-        auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
-        byteString.Get()[encodedLen] = '\0';
-
-        InsertJsonElement(jsonObj, context, byteString.Get());
-        break;
-    }
+    case TLV::kTLVType_ByteString:
+        return WriteByteString(reader);
 
     case TLV::kTLVType_UTF8String: {
         CharSpan span;
         ReturnErrorOnFailure(reader.Get(span));
-
-        std::string str(span.data(), span.size());
-        InsertJsonElement(jsonObj, context, str);
+        AppendQuotedString(mOut, span.data(), span.size());
         break;
     }
 
-    case TLV::kTLVType_Null: {
-        InsertJsonElement(jsonObj, context, Json::Value());
+    case TLV::kTLVType_Null:
+        mOut += "null";
         break;
-    }
 
-    case TLV::kTLVType_Structure: {
-        Json::Value jsonStruct(Json::objectValue);
-        ReturnErrorOnFailure(TlvStructToJson(reader, jsonStruct));
-        InsertJsonElement(jsonObj, context, jsonStruct);
-        break;
+    case TLV::kTLVType_Structure:
+        return WriteStruct(reader);
+
+    case TLV::kTLVType_Array:
+        return WriteArray(reader, arraySubType);
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
     }
 
-    case TLV::kTLVType_Array: {
-        CHIP_ERROR err;
-        Json::Value jsonArray(Json::arrayValue);
-        ElementTypeContext prevSubType;
-        ElementTypeContext nextSubType;
-        TLV::TLVType containerType;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonWriter::WriteByteString(TLV::TLVReader & reader)
+{
+    ByteSpan span;
+    ReturnErrorOnFailure(reader.Get(span));
+
+    // Base64 output never needs escaping, so encode it straight into the output.
+    const auto inLen   = static_cast<uint16_t>(span.size());
+    const size_t start = mOut.size();
+    mOut.resize(start + 1 + BASE64_ENCODED_LEN(inLen));
+    mOut[start]           = '"';
+    const auto encodedLen = Base64Encode(span.data(), inLen, &mOut[start + 1]);
+    mOut.resize(start + 1 + encodedLen);
+    mOut += '"';
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonWriter::WriteArray(TLV::TLVReader & reader, ElementTypeContext & subType)
+{
+    CHIP_ERROR err;
+    ElementTypeContext prevSubType;
+    ElementTypeContext elementSubType;
+    TLV::TLVType containerType;
+
+    // Arrays of scalars (or empty structures) are first written on a single line, remembering where
+    // each element starts, and moved to one element per line if it turns out they don't fit.
+    std::array<size_t, kMaxSingleLineArraySize> elementStarts;
+    const size_t arrayStart = mOut.size();
+    bool isMultiLine        = false;
+    size_t count            = 0;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    mIndent += kIndentSize;
 
-        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        ElementTypeContext nextSubType = GetElementTypeContext(reader);
+        if (count == 0)
         {
-            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+            prevSubType = nextSubType;
+        }
+        else
+        {
+            VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
 
-            nextSubType.tlvType = reader.GetType();
-            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
-            {
-                nextSubType.isDouble = reader.IsElementDouble();
-            }
+        if (!isMultiLine && (count == kMaxSingleLineArraySize || IsNonEmptyStruct(reader)))
+        {
+            BreakArrayIntoLines(arrayStart, elementStarts.data(), count);
+            isMultiLine = true;
+        }
 
-            if (jsonArray.empty())
-            {
-                prevSubType = nextSubType;
-            }
-            else
+        if (isMultiLine)
+        {
+            if (count > 0)
             {
-                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
-                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+                mOut += ',';
             }
-
-            // Recursively convert to JSON the encompassing item within the array.
-            ReturnErrorOnFailure(TlvToJson(reader, jsonArray));
+            WriteIndent();
+        }
+        else
+        {
+            mOut += (count == 0) ? "[ " : ", ";
+            elementStarts[count] = mOut.size();
         }
 
-        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+        // Recursively convert to JSON the encompassing item within the array.
+        ReturnErrorOnFailure(WriteValue(reader, elementSubType));
+        count++;
+    }
 
-        context.subType = prevSubType;
-        InsertJsonElement(jsonObj, context, jsonArray);
-        break;
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(containerType));
+    subType = prevSubType;
+
+    if (count == 0)
+    {
+        mIndent -= kIndentSize;
+        mOut += "[]";
+        return CHIP_NO_ERROR;
     }
 
-    default:
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        break;
+    // The single line is "[ " + elements + " ]".
+    if (!isMultiLine && (count == kMaxSingleLineArraySize || mOut.size() - arrayStart + 2 >= kRightMargin))
+    {
+        BreakArrayIntoLines(arrayStart, elementStarts.data(), count);
+        isMultiLine = true;
+    }
+
+    mIndent -= kIndentSize;
+    if (isMultiLine)
+    {
+        WriteIndent();
+        mOut += ']';
+    }
+    else
+    {
+        mOut += " ]";
     }
 
     return CHIP_NO_ERROR;
 }
 
+bool JsonWriter::IsNonEmptyStruct(const TLV::TLVReader & reader)
+{
+    VerifyOrReturnValue(reader.GetType() == TLV::kTLVType_Structure, false);
+
+    TLV::TLVReader structReader;
+    TLV::TLVType containerType;
+    structReader.Init(reader);
+    return structReader.EnterContainer(containerType) == CHIP_NO_ERROR && structReader.Next() == CHIP_NO_ERROR;
+}
+
+void JsonWriter::BreakArrayIntoLines(size_t arrayStart, const size_t * elementStarts, size_t count)
+{
+    // Everything after "[ " is the elements written so far, separated by ", ".
+    const std::string elements(mOut, arrayStart);
+    mOut.resize(arrayStart);
+    mOut += '[';
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t start = elementStarts[i] - arrayStart;
+        const size_t end   = (i + 1 < count) ? elementStarts[i + 1] - arrayStart - 2 : elements.size();
+        if (i > 0)
+        {
+            mOut += ',';
+        }
+        WriteIndent();
+        mOut.append(elements, start, end - start);
+    }
+}
+
 } // namespace
 
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
@@ -350,11 +756,12 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     // During json conversion, a implicit profile ID is required
     ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
 
-    Json::Value jsonObject(Json::objectValue);
-    ReturnErrorOnFailure(TlvStructToJson(reader, jsonObject));
+    std::string json;
+    JsonWriter writer(json);
+    ReturnErrorOnFailure(writer.WriteStruct(reader));
+    json += '\n';
 
-    Json::StyledWriter writer;
-    jsonString = writer.write(jsonObject);
+    jsonString = std::move(json);
     return CHIP_NO_ERROR;
 }
 } // namespace chip
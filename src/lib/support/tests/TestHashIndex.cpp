@@ -0,0 +1,159 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <map>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/HashIndex.h>
+
+namespace {
+
+using namespace chip;
+
+struct Entry
+{
+    uint32_t key;
+    bool present;
+};
+
+TEST(TestHashIndex, TestAddFindRemove)
+{
+    Entry entries[8];
+    HashIndex<Entry, 8> index;
+
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        entries[i].key = i * 64;
+        index.Add(entries[i].key, &entries[i]);
+    }
+    EXPECT_EQ(index.Count(), 8u);
+    EXPECT_TRUE(index.IsComplete());
+
+    for (auto & entry : entries)
+    {
+        EXPECT_EQ(index.Find(entry.key), &entry);
+    }
+    EXPECT_EQ(index.Find(1), nullptr);
+
+    index.Remove(entries[3].key, &entries[3]);
+    EXPECT_EQ(index.Find(entries[3].key), nullptr);
+    EXPECT_EQ(index.Count(), 7u);
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        if (i != 3)
+        {
+            EXPECT_EQ(index.Find(entries[i].key), &entries[i]);
+        }
+    }
+}
+
+TEST(TestHashIndex, TestSharedKeys)
+{
+    Entry entries[4] = { { 7, false }, { 7, true }, { 7, false }, { 7, true } };
+    HashIndex<Entry, 4> index;
+
+    for (auto & entry : entries)
+    {
+        index.Add(entry.key, &entry);
+    }
+
+    EXPECT_EQ(index.Find(7), &entries[0]);
+    EXPECT_EQ(index.Find(7, [](Entry * entry) { return entry->present; }), &entries[1]);
+
+    index.Remove(7, &entries[1]);
+    EXPECT_EQ(index.Find(7, [](Entry * entry) { return entry->present; }), &entries[3]);
+
+    index.Remove(7, &entries[0]);
+    index.Remove(7, &entries[3]);
+    EXPECT_EQ(index.Find(7), &entries[2]);
+    index.Remove(7, &entries[2]);
+    EXPECT_EQ(index.Find(7), nullptr);
+    EXPECT_EQ(index.Count(), 0u);
+}
+
+TEST(TestHashIndex, TestOverflow)
+{
+    Entry entries[6];
+    HashIndex<Entry, 4> index;
+
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        entries[i].key = i;
+        index.Add(entries[i].key, &entries[i]);
+    }
+    EXPECT_EQ(index.Count(), 6u);
+    EXPECT_FALSE(index.IsComplete());
+    EXPECT_EQ(index.Find(4), nullptr);
+
+    // Removing the objects that did not fit makes the index complete again.
+    index.Remove(4, &entries[4]);
+    index.Remove(5, &entries[5]);
+    EXPECT_TRUE(index.IsComplete());
+
+    index.Remove(0, &entries[0]);
+    index.Add(4, &entries[4]);
+    EXPECT_TRUE(index.IsComplete());
+    EXPECT_EQ(index.Find(4), &entries[4]);
+}
+
+TEST(TestHashIndex, TestRandomOperations)
+{
+    unsigned seed = static_cast<unsigned>(std::time(nullptr));
+    printf("Running " __FILE__ " using seed %d \n", seed);
+    std::srand(seed);
+
+    constexpr size_t kCount = 32;
+    Entry entries[kCount];
+    HashIndex<Entry, kCount> index;
+    std::map<Entry *, uint32_t> reference;
+
+    for (auto & entry : entries)
+    {
+        entry.present = false;
+    }
+
+    for (int i = 0; i < 10000; i++)
+    {
+        Entry & entry = entries[static_cast<size_t>(std::rand()) % kCount];
+        if (entry.present)
+        {
+            index.Remove(entry.key, &entry);
+            reference.erase(&entry);
+            entry.present = false;
+        }
+        else
+        {
+            // Few distinct keys, so that probe runs are long and shared.
+            entry.key = static_cast<uint32_t>(std::rand() % 16);
+            index.Add(entry.key, &entry);
+            reference[&entry] = entry.key;
+            entry.present     = true;
+        }
+
+        ASSERT_EQ(index.Count(), reference.size());
+        for (auto & item : reference)
+        {
+            Entry * expected = item.first;
+            ASSERT_EQ(index.Find(item.second, [expected](Entry * candidate) { return candidate == expected; }), expected);
+        }
+    }
+}
+
+} // namespace
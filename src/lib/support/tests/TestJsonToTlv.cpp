@@ -394,4 +394,30 @@ TEST_F(TestJsonToTlv, TestMEIConvert)
         EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
     }
 }
+
+TEST_F(TestJsonToTlv, TestConvertToAllocatedBuffer)
+{
+    // Larger than the arena's first chunks, so the encoding spans several of them.
+    std::string jsonString = "{\"1:ARRAY-UINT\" : [";
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        jsonString += (i == 0) ? "" : ", ";
+        jsonString += std::to_string(100000 + i);
+    }
+    jsonString += "], \"2:STRING\" : \"hello\"}";
+
+    uint8_t buf[8192];
+    MutableByteSpan expected(buf);
+    EXPECT_EQ(JsonToTlv(jsonString, expected), CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBufferWithSize<uint8_t> tlv;
+    EXPECT_EQ(JsonToTlv(jsonString, tlv), CHIP_NO_ERROR);
+    ASSERT_EQ(tlv.AllocatedSize(), expected.size());
+    EXPECT_EQ(memcmp(tlv.Get(), expected.data(), expected.size()), 0);
+
+    // Conversion errors are reported, and leave nothing allocated
+    Platform::ScopedMemoryBufferWithSize<uint8_t> invalid;
+    EXPECT_NE(JsonToTlv("{\"1:INVALID\" : 1}", invalid), CHIP_NO_ERROR);
+    EXPECT_EQ(invalid.Get(), nullptr);
+}
 } // namespace
@@ -245,4 +245,69 @@ TEST_F(TestTlvToJson, TestConverter)
     EncodeAndValidate(structList, jsonString);
 }
 
+TEST_F(TestTlvToJson, TestExactLayout)
+{
+    TLV::TLVType outer;
+    TLV::TLVType array;
+
+    SetupBuf();
+
+    ASSERT_EQ(gWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+
+    ASSERT_EQ(gWriter.StartContainer(TLV::ContextTag(4), TLV::kTLVType_Array, array), CHIP_NO_ERROR);
+    for (uint16_t i = 0; i < 20; i++)
+    {
+        ASSERT_EQ(gWriter.Put(TLV::AnonymousTag(), static_cast<uint16_t>(1000 + i)), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(gWriter.EndContainer(array), CHIP_NO_ERROR);
+
+    ASSERT_EQ(gWriter.Put(TLV::ContextTag(3), static_cast<uint64_t>(0xFFFFFFFFFF)), CHIP_NO_ERROR);
+
+    ASSERT_EQ(gWriter.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, array), CHIP_NO_ERROR);
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        ASSERT_EQ(gWriter.Put(TLV::AnonymousTag(), i), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(gWriter.EndContainer(array), CHIP_NO_ERROR);
+
+    ASSERT_EQ(gWriter.PutString(TLV::ContextTag(10), "a\"b\\\n\x01\xc3\xa9"), CHIP_NO_ERROR);
+
+    ASSERT_EQ(gWriter.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(gWriter.Finalize(), CHIP_NO_ERROR);
+    ASSERT_EQ(SetupReader(), CHIP_NO_ERROR);
+
+    // Compared as is rather than through PrettyPrintJsonString, to check member ordering, escaping
+    // and the layout of short and long arrays.
+    std::string jsonString;
+    ASSERT_EQ(TlvToJson(gReader, jsonString), CHIP_NO_ERROR);
+    EXPECT_EQ(jsonString,
+              "{\n"
+              "   \"10:STRING\" : \"a\\\"b\\\\\\n\\u0001\\u00e9\",\n"
+              "   \"2:ARRAY-UINT\" : [ 1, 2, 3 ],\n"
+              "   \"3:UINT\" : \"1099511627775\",\n"
+              "   \"4:ARRAY-UINT\" : [\n"
+              "      1000,\n"
+              "      1001,\n"
+              "      1002,\n"
+              "      1003,\n"
+              "      1004,\n"
+              "      1005,\n"
+              "      1006,\n"
+              "      1007,\n"
+              "      1008,\n"
+              "      1009,\n"
+              "      1010,\n"
+              "      1011,\n"
+              "      1012,\n"
+              "      1013,\n"
+              "      1014,\n"
+              "      1015,\n"
+              "      1016,\n"
+              "      1017,\n"
+              "      1018,\n"
+              "      1019\n"
+              "   ]\n"
+              "}\n");
+}
+
 } // namespace
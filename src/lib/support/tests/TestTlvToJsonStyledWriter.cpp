@@ -0,0 +1,736 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Differential tests checking that TlvToJson produces exactly what the equivalent Json::Value
+ *      tree rendered by Json::StyledWriter produces, which is how the converter used to work.
+ */
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <json/json.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/Base64.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/jsontlv/ElementTypes.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
+
+// Large enough for the biggest payload any of the tests generates.
+constexpr size_t kMaxPayloadSize = 64 * 1024;
+
+/*
+ * Reference implementation: the TLV is converted into a Json::Value tree, which is then rendered
+ * with Json::StyledWriter.
+ */
+namespace Reference {
+
+const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
+{
+    switch (ctx.tlvType)
+    {
+    case TLV::kTLVType_UnsignedInteger:
+        return kElementTypeUInt;
+    case TLV::kTLVType_SignedInteger:
+        return kElementTypeInt;
+    case TLV::kTLVType_Boolean:
+        return kElementTypeBool;
+    case TLV::kTLVType_FloatingPointNumber:
+        return ctx.isDouble ? kElementTypeDouble : kElementTypeFloat;
+    case TLV::kTLVType_ByteString:
+        return kElementTypeBytes;
+    case TLV::kTLVType_UTF8String:
+        return kElementTypeString;
+    case TLV::kTLVType_Null:
+        return kElementTypeNull;
+    case TLV::kTLVType_Structure:
+        return kElementTypeStruct;
+    case TLV::kTLVType_Array:
+        return kElementTypeArray;
+    default:
+        return kElementTypeEmpty;
+    }
+}
+
+struct JsonObjectElementContext
+{
+    JsonObjectElementContext(TLV::TLVReader & reader)
+    {
+        tag               = reader.GetTag();
+        implicitProfileId = reader.ImplicitProfileId;
+        type.tlvType      = reader.GetType();
+        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+        {
+            type.isDouble = reader.IsElementDouble();
+        }
+    }
+
+    std::string GenerateJsonElementName() const
+    {
+        std::string str = "???";
+        if (TLV::IsContextTag(tag))
+        {
+            str = std::to_string(TLV::TagNumFromTag(tag));
+        }
+        else if (TLV::IsProfileTag(tag))
+        {
+            if (TLV::ProfileIdFromTag(tag) == implicitProfileId)
+            {
+                str = std::to_string(TLV::TagNumFromTag(tag));
+            }
+            else
+            {
+                uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
+                str                = std::to_string(tagNumber);
+            }
+        }
+        str = str + ":" + GetJsonElementStrFromType(type);
+        if (type.tlvType == TLV::kTLVType_Array)
+        {
+            str = str + "-" + GetJsonElementStrFromType(subType);
+        }
+        return str;
+    }
+
+    TLV::Tag tag;
+    uint32_t implicitProfileId;
+    ElementTypeContext type;
+    ElementTypeContext subType;
+};
+
+template <typename T>
+void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+{
+    if (json.isArray())
+    {
+        json.append(val);
+    }
+    else
+    {
+        json[ctx.GenerateJsonElementName()] = val;
+    }
+}
+
+CHIP_ERROR ConvertElement(TLV::TLVReader & reader, Json::Value & jsonObj);
+
+CHIP_ERROR ConvertStruct(TLV::TLVReader & reader, Json::Value & jsonObj)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+        {
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+        }
+
+        ReturnErrorOnFailure(ConvertElement(reader, jsonObj));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR ConvertElement(TLV::TLVReader & reader, Json::Value & jsonObj)
+{
+    JsonObjectElementContext context(reader);
+
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<uint32_t>(v))
+        {
+            InsertJsonElement(jsonObj, context, v);
+        }
+        else
+        {
+            InsertJsonElement(jsonObj, context, std::to_string(v));
+        }
+        break;
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (CanCastTo<int32_t>(v))
+        {
+            InsertJsonElement(jsonObj, context, v);
+        }
+        else
+        {
+            InsertJsonElement(jsonObj, context, std::to_string(v));
+        }
+        break;
+    }
+
+    case TLV::kTLVType_Boolean: {
+        bool v;
+        ReturnErrorOnFailure(reader.Get(v));
+        InsertJsonElement(jsonObj, context, v);
+        break;
+    }
+
+    case TLV::kTLVType_FloatingPointNumber: {
+        double v;
+        ReturnErrorOnFailure(reader.Get(v));
+        if (v == std::numeric_limits<double>::infinity())
+        {
+            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
+        }
+        else if (v == -std::numeric_limits<double>::infinity())
+        {
+            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
+        }
+        else
+        {
+            InsertJsonElement(jsonObj, context, v);
+        }
+        break;
+    }
+
+    case TLV::kTLVType_ByteString: {
+        ByteSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+
+        Platform::ScopedMemoryBuffer<char> byteString;
+        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
+        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
+        byteString.Get()[encodedLen] = '\0';
+
+        InsertJsonElement(jsonObj, context, byteString.Get());
+        break;
+    }
+
+    case TLV::kTLVType_UTF8String: {
+        CharSpan span;
+        ReturnErrorOnFailure(reader.Get(span));
+
+        std::string str(span.data(), span.size());
+        InsertJsonElement(jsonObj, context, str);
+        break;
+    }
+
+    case TLV::kTLVType_Null: {
+        InsertJsonElement(jsonObj, context, Json::Value());
+        break;
+    }
+
+    case TLV::kTLVType_Structure: {
+        Json::Value jsonStruct(Json::objectValue);
+        ReturnErrorOnFailure(ConvertStruct(reader, jsonStruct));
+        InsertJsonElement(jsonObj, context, jsonStruct);
+        break;
+    }
+
+    case TLV::kTLVType_Array: {
+        CHIP_ERROR err;
+        Json::Value jsonArray(Json::arrayValue);
+        ElementTypeContext prevSubType;
+        ElementTypeContext nextSubType;
+        TLV::TLVType containerType;
+
+        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+            nextSubType.tlvType = reader.GetType();
+            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
+            {
+                nextSubType.isDouble = reader.IsElementDouble();
+            }
+
+            if (jsonArray.empty())
+            {
+                prevSubType = nextSubType;
+            }
+            else
+            {
+                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
+                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+            }
+
+            ReturnErrorOnFailure(ConvertElement(reader, jsonArray));
+        }
+
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+        context.subType = prevSubType;
+        InsertJsonElement(jsonObj, context, jsonArray);
+        break;
+    }
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
+{
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    Json::Value jsonObject(Json::objectValue);
+    ReturnErrorOnFailure(ConvertStruct(reader, jsonObject));
+
+    Json::StyledWriter writer;
+    jsonString = writer.write(jsonObject);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Reference
+
+/*
+ * Converts the TLV with both implementations and checks that they agree on the result, the JSON
+ * output and how far they read.  Returns false on the first difference.
+ */
+bool ConvertsLikeStyledWriter(const uint8_t * tlv, size_t length)
+{
+    TLV::TLVReader expectedReader;
+    TLV::TLVReader actualReader;
+    expectedReader.Init(tlv, length);
+    actualReader.Init(tlv, length);
+    expectedReader.ImplicitProfileId = kTemporaryImplicitProfileId;
+    actualReader.ImplicitProfileId   = kTemporaryImplicitProfileId;
+
+    // Both only ever see a reader positioned on an element.
+    if (expectedReader.Next() != CHIP_NO_ERROR || actualReader.Next() != CHIP_NO_ERROR)
+    {
+        return true;
+    }
+
+    std::string expected;
+    std::string actual;
+    const CHIP_ERROR expectedErr = Reference::TlvToJson(expectedReader, expected);
+    const CHIP_ERROR actualErr   = TlvToJson(actualReader, actual);
+
+    EXPECT_EQ(actualErr, expectedErr);
+    EXPECT_EQ(actualReader.GetLengthRead(), expectedReader.GetLengthRead());
+    if (expectedErr == CHIP_NO_ERROR)
+    {
+        EXPECT_EQ(actual, expected);
+        return actualErr == expectedErr && actualReader.GetLengthRead() == expectedReader.GetLengthRead() && actual == expected;
+    }
+    return actualErr == expectedErr && actualReader.GetLengthRead() == expectedReader.GetLengthRead();
+}
+
+/*
+ * Generates random TLV payloads covering every element type TlvToJson supports, along with the
+ * invalid constructs it has to reject.
+ */
+class PayloadGenerator
+{
+public:
+    PayloadGenerator(uint32_t seed) : mRandom(seed) {}
+
+    uint32_t Random(uint32_t bound) { return static_cast<uint32_t>(mRandom() % bound); }
+    bool OneIn(uint32_t n) { return Random(n) == 0; }
+
+    TLV::Tag RandomMemberTag()
+    {
+        switch (Random(6))
+        {
+        case 0:
+            return TLV::ProfileTag(kTemporaryImplicitProfileId, 256 + Random(100000));
+        case 1:
+            return TLV::ProfileTag(static_cast<uint16_t>(Random(3)), 0, Random(1000));
+        case 2:
+            return TLV::ContextTag(static_cast<uint8_t>(Random(256)));
+        default:
+            // Few distinct tags, so that names collide.
+            return TLV::ContextTag(static_cast<uint8_t>(Random(4)));
+        }
+    }
+
+    // Mostly valid UTF-8, with control characters, characters that need escaping, and malformed sequences.
+    std::string RandomString(size_t maxLength)
+    {
+        static const char * const kPieces[] = {
+            // Characters that need escaping.
+            "\"", "\\", "/", "\n", "\t", "\b", "\x01", "\x1f", "\x7f",
+            // Valid 2, 3 and 4 byte sequences.
+            "\xc3\xa9", "\xdf\xbf", "\xe2\x82\xac", "\xef\xbf\xbf", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf",
+            // Overlong, surrogate, truncated and stray continuation sequences.
+            "\xc0\x80", "\xed\xa0\x80", "\xe2\x82", "\xf0\x9f", "\x80", "\xbf", "\xf8\x88\x80\x80\x80", "\xff",
+        };
+
+        std::string str;
+        const size_t length = Random(static_cast<uint32_t>(maxLength) + 1);
+        while (str.size() < length)
+        {
+            if (OneIn(3))
+            {
+                str += kPieces[Random(ArraySize(kPieces))];
+            }
+            else
+            {
+                str += static_cast<char>(' ' + Random(95));
+            }
+        }
+        return str;
+    }
+
+    CHIP_ERROR WriteScalar(TLV::TLVWriter & writer, TLV::Tag tag, uint32_t type)
+    {
+        switch (type)
+        {
+        case 0:
+            return writer.Put(tag, OneIn(2) ? static_cast<uint64_t>(Random(1000)) : RandomUInt64());
+        case 1:
+            return writer.Put(tag, OneIn(2) ? static_cast<int64_t>(Random(1000)) - 500 : static_cast<int64_t>(RandomUInt64()));
+        case 2:
+            return writer.PutBoolean(tag, OneIn(2));
+        case 3: {
+            static const double kValues[] = { 0.0,
+                                              1.5,
+                                              -2.0,
+                                              1e300,
+                                              -1e-300,
+                                              1.0 / 3,
+                                              123456789.0,
+                                              1e-7,
+                                              std::numeric_limits<double>::infinity(),
+                                              -std::numeric_limits<double>::infinity(),
+                                              std::numeric_limits<double>::quiet_NaN(),
+                                              std::numeric_limits<double>::max(),
+                                              std::numeric_limits<double>::denorm_min() };
+            return writer.Put(tag, OneIn(4) ? static_cast<double>(mRandom()) / 7 : kValues[Random(ArraySize(kValues))]);
+        }
+        case 4: {
+            static const float kValues[] = { 0.1f, 2.5f, -7.0f, 3.3e10f, std::numeric_limits<float>::infinity() };
+            return writer.Put(tag, kValues[Random(ArraySize(kValues))]);
+        }
+        case 5: {
+            uint8_t bytes[300];
+            const size_t length = Random(OneIn(4) ? sizeof(bytes) : 12);
+            for (size_t i = 0; i < length; i++)
+            {
+                bytes[i] = static_cast<uint8_t>(mRandom());
+            }
+            return writer.Put(tag, ByteSpan(bytes, length));
+        }
+        case 6: {
+            const std::string str = RandomString(OneIn(4) ? 120 : 12);
+            return writer.PutString(tag, str.data(), static_cast<uint32_t>(str.size()));
+        }
+        default:
+            return writer.PutNull(tag);
+        }
+    }
+
+    CHIP_ERROR WriteArray(TLV::TLVWriter & writer, TLV::Tag tag, uint32_t depth)
+    {
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
+
+        // Lengths around the 25 element single line limit are the interesting ones.
+        const uint32_t count = OneIn(3) ? 20 + Random(10) : Random(8);
+        const uint32_t type  = Random(9);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (OneIn(500))
+            {
+                // Invalid: nested array, or mixed element types.
+                if (OneIn(2))
+                {
+                    ReturnErrorOnFailure(WriteArray(writer, TLV::AnonymousTag(), depth + 1));
+                }
+                else
+                {
+                    ReturnErrorOnFailure(WriteScalar(writer, TLV::AnonymousTag(), (type + 1) % 8));
+                }
+            }
+            else if (type == 8)
+            {
+                ReturnErrorOnFailure(WriteStruct(writer, TLV::AnonymousTag(), (depth < kMaxDepth && !OneIn(3)) ? depth + 1 : 0));
+            }
+            else
+            {
+                ReturnErrorOnFailure(WriteScalar(writer, TLV::AnonymousTag(), type));
+            }
+        }
+
+        return writer.EndContainer(containerType);
+    }
+
+    // A depth of 0 writes an empty structure.
+    CHIP_ERROR WriteStruct(TLV::TLVWriter & writer, TLV::Tag tag, uint32_t depth)
+    {
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+
+        const uint32_t count = (depth == 0) ? 0 : Random(8);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            TLV::Tag memberTag = RandomMemberTag();
+            if (OneIn(500))
+            {
+                // Invalid: vendor 0 profile tag in the reserved range.  The writer does not allow
+                // other invalid tags, those come from the corrupted payloads.
+                memberTag = TLV::ProfileTag(0, 0, Random(256));
+            }
+
+            const uint32_t kind = Random(12);
+            if (kind == 10 && depth < kMaxDepth)
+            {
+                ReturnErrorOnFailure(WriteStruct(writer, memberTag, depth + 1));
+            }
+            else if (kind == 11 && depth < kMaxDepth)
+            {
+                ReturnErrorOnFailure(WriteArray(writer, memberTag, depth + 1));
+            }
+            else
+            {
+                ReturnErrorOnFailure(WriteScalar(writer, memberTag, kind % 9));
+            }
+        }
+
+        return writer.EndContainer(containerType);
+    }
+
+    // Returns the length of the payload, or 0 if it does not fit.
+    size_t WritePayload(uint8_t * buffer, size_t bufferSize)
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer, bufferSize);
+        writer.ImplicitProfileId = kTemporaryImplicitProfileId;
+        VerifyOrReturnValue(WriteStruct(writer, TLV::AnonymousTag(), 1) == CHIP_NO_ERROR, 0);
+        VerifyOrReturnValue(writer.Finalize() == CHIP_NO_ERROR, 0);
+        return writer.GetLengthWritten();
+    }
+
+private:
+    static constexpr uint32_t kMaxDepth = 6;
+
+    uint64_t RandomUInt64() { return (static_cast<uint64_t>(mRandom()) << 32) | mRandom(); }
+
+    std::mt19937 mRandom;
+};
+
+class TestTlvToJsonStyledWriter : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestTlvToJsonStyledWriter, TestRandomPayloads)
+{
+    PayloadGenerator generator(1);
+    std::vector<uint8_t> buffer(kMaxPayloadSize);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        const size_t length = generator.WritePayload(buffer.data(), buffer.size());
+        ASSERT_GT(length, 0u);
+        ASSERT_TRUE(ConvertsLikeStyledWriter(buffer.data(), length));
+    }
+}
+
+TEST_F(TestTlvToJsonStyledWriter, TestMutatedPayloads)
+{
+    PayloadGenerator generator(2);
+    std::vector<uint8_t> buffer(kMaxPayloadSize);
+
+    for (int i = 0; i < 2000; i++)
+    {
+        const size_t length = generator.WritePayload(buffer.data(), buffer.size());
+        ASSERT_GT(length, 0u);
+
+        // Truncated payloads.
+        for (int j = 0; j < 4; j++)
+        {
+            ASSERT_TRUE(ConvertsLikeStyledWriter(buffer.data(), generator.Random(static_cast<uint32_t>(length))));
+        }
+
+        // Corrupted payloads.
+        for (int j = 0; j < 4; j++)
+        {
+            std::vector<uint8_t> corrupted(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(length));
+            const uint32_t flips = 1 + generator.Random(3);
+            for (uint32_t k = 0; k < flips; k++)
+            {
+                corrupted[generator.Random(static_cast<uint32_t>(length))] ^= static_cast<uint8_t>(1 + generator.Random(255));
+            }
+            ASSERT_TRUE(ConvertsLikeStyledWriter(corrupted.data(), corrupted.size()));
+        }
+    }
+}
+
+TEST_F(TestTlvToJsonStyledWriter, TestArraysNearRightMargin)
+{
+    uint8_t buffer[4096];
+
+    // Arrays whose single line rendering is just below, at or above the right margin, or whose
+    // element count is around the single line limit, at different nesting depths.
+    for (uint32_t depth = 0; depth < 3; depth++)
+    {
+        for (uint32_t count = 1; count <= 30; count++)
+        {
+            for (uint32_t elementLength = 1; elementLength <= 12; elementLength++)
+            {
+                for (bool strings : { false, true })
+                {
+                    TLV::TLVWriter writer;
+                    TLV::TLVType outerTypes[4];
+                    TLV::TLVType arrayType;
+                    writer.Init(buffer);
+
+                    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerTypes[0]), CHIP_NO_ERROR);
+                    for (uint32_t i = 0; i < depth; i++)
+                    {
+                        ASSERT_EQ(writer.StartContainer(TLV::ContextTag(static_cast<uint8_t>(i)), TLV::kTLVType_Structure,
+                                                        outerTypes[i + 1]),
+                                  CHIP_NO_ERROR);
+                    }
+
+                    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(5), TLV::kTLVType_Array, arrayType), CHIP_NO_ERROR);
+                    for (uint32_t i = 0; i < count; i++)
+                    {
+                        if (strings)
+                        {
+                            // Quoted, so two columns wider than the string itself.
+                            const std::string str(elementLength, static_cast<char>('a' + i % 26));
+                            ASSERT_EQ(writer.PutString(TLV::AnonymousTag(), str.data(), static_cast<uint32_t>(str.size())),
+                                      CHIP_NO_ERROR);
+                        }
+                        else
+                        {
+                            uint64_t value = 1;
+                            for (uint32_t j = 1; j < elementLength; j++)
+                            {
+                                value *= 10;
+                            }
+                            ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value + i % 10), CHIP_NO_ERROR);
+                        }
+                    }
+                    ASSERT_EQ(writer.EndContainer(arrayType), CHIP_NO_ERROR);
+
+                    for (uint32_t i = depth + 1; i > 0; i--)
+                    {
+                        ASSERT_EQ(writer.EndContainer(outerTypes[i - 1]), CHIP_NO_ERROR);
+                    }
+                    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+                    ASSERT_TRUE(ConvertsLikeStyledWriter(buffer, writer.GetLengthWritten()));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TestTlvToJsonStyledWriter, TestDeepNesting)
+{
+    constexpr uint32_t kDepth = 32;
+    uint8_t buffer[4096];
+
+    TLV::TLVWriter writer;
+    TLV::TLVType outerTypes[2 * kDepth + 1];
+    writer.Init(buffer);
+
+    // Alternate structures and arrays of structures, with a few members at each level.
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerTypes[0]), CHIP_NO_ERROR);
+    size_t open = 1;
+    for (uint32_t i = 0; i < kDepth; i++)
+    {
+        ASSERT_EQ(writer.Put(TLV::ContextTag(static_cast<uint8_t>(i)), i), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.PutString(TLV::ContextTag(200), "\xc3\xa9t\xc3\xa9"), CHIP_NO_ERROR);
+        if (i % 2 == 0)
+        {
+            ASSERT_EQ(writer.StartContainer(TLV::ContextTag(100), TLV::kTLVType_Structure, outerTypes[open++]), CHIP_NO_ERROR);
+        }
+        else
+        {
+            ASSERT_EQ(writer.StartContainer(TLV::ContextTag(101), TLV::kTLVType_Array, outerTypes[open++]), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerTypes[open++]), CHIP_NO_ERROR);
+        }
+    }
+    while (open > 0)
+    {
+        ASSERT_EQ(writer.EndContainer(outerTypes[--open]), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    ASSERT_TRUE(ConvertsLikeStyledWriter(buffer, writer.GetLengthWritten()));
+
+    // Errors found deep inside the payload, with the payload also truncated right after them.
+    for (size_t length = 1; length < writer.GetLengthWritten(); length++)
+    {
+        ASSERT_TRUE(ConvertsLikeStyledWriter(buffer, length));
+    }
+}
+
+TEST_F(TestTlvToJsonStyledWriter, TestInvalidMemberBeforeTruncation)
+{
+    uint8_t buffer[256];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    TLV::TLVType innerType;
+    writer.Init(buffer);
+
+    // The nested structure has an invalid member, and the payload is cut short after it: the invalid
+    // member has to be reported, not the truncation.
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Structure, innerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ProfileTag(0, 0, 1), static_cast<uint32_t>(1)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(2), static_cast<uint32_t>(2)), CHIP_NO_ERROR);
+    const size_t truncatedLength = writer.GetLengthWritten();
+    ASSERT_EQ(writer.EndContainer(innerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    reader.Init(buffer, truncatedLength);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    std::string json;
+    EXPECT_EQ(TlvToJson(reader, json), CHIP_ERROR_INVALID_TLV_TAG);
+
+    EXPECT_TRUE(ConvertsLikeStyledWriter(buffer, truncatedLength));
+    EXPECT_TRUE(ConvertsLikeStyledWriter(buffer, writer.GetLengthWritten()));
+}
+
+} // namespace
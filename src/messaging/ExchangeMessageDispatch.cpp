@@ -48,6 +48,12 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SessionManager * sessionManager,
         // If there is a pending acknowledgment piggyback it on this message.
         if (reliableMessageContext->HasPiggybackAckPending())
         {
+            if (reliableMessageContext->IsAckPending() && reliableMessageContext->GetReliableMessageMgr() != nullptr)
+            {
+                const bool isStandaloneAck = (protocol == Protocols::SecureChannel::Id) &&
+                    type == to_underlying(Protocols::SecureChannel::MsgType::StandaloneAck);
+                reliableMessageContext->GetReliableMessageMgr()->CountAckSent(isStandaloneAck);
+            }
             payloadHeader.SetAckMessageCounter(reliableMessageContext->TakePendingPeerAckMessageCounter());
         }
 
@@ -34,6 +34,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <tracing/macros.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -102,6 +103,26 @@ void ExchangeManager::Shutdown()
     mState = State::kState_NotInitialized;
 }
 
+template <typename... Args>
+ExchangeContext * ExchangeManager::AllocateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator,
+                                                   Args &&... args)
+{
+    ExchangeContext * ec = mContextPool.CreateObject(this, exchangeId, session, isInitiator, std::forward<Args>(args)...);
+    if (ec != nullptr)
+    {
+        mContextIndex.Add(ExchangeIndexKey(exchangeId, isInitiator), ec);
+        MATTER_TRACE_COUNTER_VALUE("ActiveExchanges", mContextPool.Allocated());
+    }
+    return ec;
+}
+
+void ExchangeManager::ReleaseContext(ExchangeContext * ec)
+{
+    mContextIndex.Remove(ExchangeIndexKey(ec->GetExchangeId(), ec->IsInitiator()), ec);
+    mContextPool.ReleaseObject(ec);
+    MATTER_TRACE_COUNTER_VALUE("ActiveExchanges", mContextPool.Allocated());
+}
+
 ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator)
 {
     if (!session->IsActiveSession())
@@ -115,7 +136,32 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         // Disallow creating exchange on an inactive session
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return AllocateContext(mNextExchangeId++, session, isInitiator, delegate);
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    auto matches = [&](ExchangeContext * ec) { return ec->MatchExchange(session, packetHeader, payloadHeader); };
+
+    // A message sent by an initiator belongs to a responder exchange, and vice versa.
+    ExchangeContext * found =
+        mContextIndex.Find(ExchangeIndexKey(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator()), matches);
+    if (found != nullptr || mContextIndex.IsComplete())
+    {
+        return found;
+    }
+
+    // There are more exchanges than the index can hold, which heap-allocated pools allow.
+    mContextPool.ForEachActiveObject([&](auto * ec) {
+        if (matches(ec))
+        {
+            found = ec;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -262,23 +308,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -360,7 +397,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -412,8 +449,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                           true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -27,6 +27,7 @@
 #include <array>
 
 #include <lib/support/DLLUtil.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Pool.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
@@ -108,7 +109,7 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec);
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -238,6 +239,21 @@ private:
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
 
+    // Indexes mContextPool by exchange ID and initiator flag, which never change over the lifetime of an
+    // exchange, so that matching every incoming message to its exchange does not have to scan the pool.
+    HashIndex<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextIndex;
+
+    static uint32_t ExchangeIndexKey(uint16_t exchangeId, bool isInitiator)
+    {
+        return static_cast<uint32_t>(exchangeId) | (isInitiator ? (1u << 16) : 0u);
+    }
+
+    template <typename... Args>
+    ExchangeContext * AllocateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator, Args &&... args);
+
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
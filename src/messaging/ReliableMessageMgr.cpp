@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -36,6 +37,7 @@
 #include <messaging/ReliableMessageContext.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <platform/ConnectivityManager.h>
+#include <tracing/macros.h>
 #include <tracing/metric_event.h>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -49,6 +51,42 @@ namespace chip {
 namespace Messaging {
 
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
+bool ReliableMessageMgr::sAdaptiveRetransTimeout                       = CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL;
+
+namespace {
+
+// Each exchange has at most one entry in the retransmission table, so its exchange ID and initiator flag, which never change,
+// are a good key for the entry.
+uint32_t RetransTableIndexKey(const ExchangeContext & ec)
+{
+    return static_cast<uint32_t>(ec.GetExchangeId()) | (ec.IsInitiator() ? (1u << 16) : 0u);
+}
+
+// How many peers with a due standalone ack ExecuteActions remembers, to send their other pending acks along.
+constexpr size_t kMaxAckCoalescingSessions = 8;
+
+const Transport::Session * GetAckSession(ExchangeContext * ec)
+{
+    return ec->HasSessionHandle() ? ec->GetSessionHandle().operator->() : nullptr;
+}
+
+// The measured round-trip time only ever lengthens the active interval: the peer asked for at least that much time to answer
+// while active, however fast it answered so far.  A peer that may be idle (e.g. a sleepy end device) can take up to its idle
+// interval to answer, and that is also the longest it claims to need, so it bounds the measured value.
+System::Clock::Timeout GetAdaptiveBaseTimeout(System::Clock::Timeout baseTimeout, bool peerIsActive,
+                                              const ReliableMessageProtocolConfig & remoteConfig,
+                                              const Transport::RoundTripTimeEstimator & estimator)
+{
+    VerifyOrReturnValue(peerIsActive && estimator.HasEstimate(), baseTimeout);
+
+    System::Clock::Timeout timeout = estimator.GetRetransTimeout();
+    timeout                        = std::max<System::Clock::Timeout>(timeout, CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL);
+    timeout                        = std::max<System::Clock::Timeout>(timeout, remoteConfig.mActiveRetransTimeout);
+    timeout                        = std::min<System::Clock::Timeout>(timeout, remoteConfig.mIdleRetransTimeout);
+    return timeout;
+}
+
+} // namespace
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
     ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
@@ -62,7 +100,7 @@ ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
 }
 
 ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
-    mContextPool(contextPool), mSystemLayer(nullptr)
+    mContextPool(contextPool), mSystemLayer(nullptr), mAckCoalescingWindow(CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW)
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -78,7 +116,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransTableEntry(*entry);
         return Loop::Continue;
     });
 
@@ -103,12 +141,20 @@ void ReliableMessageMgr::TicklessDebugDumpRetransTable(const char * log)
 
 void ReliableMessageMgr::ExecuteActions()
 {
+    MATTER_TRACE_SCOPE("ExecuteActions", "ReliableMessageMgr");
+
     System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
 
 #if defined(RMP_TICKLESS_DEBUG)
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions at 0x" ChipLogFormatX64 "ms", ChipLogValueX64(now.count()));
 #endif
 
+    const Transport::Session * ackedSessions[kMaxAckCoalescingSessions];
+    size_t numAckedSessions = 0;
+    auto isAckedSession     = [&](const Transport::Session * session) {
+        return std::find(ackedSessions, ackedSessions + numAckedSessions, session) != ackedSessions + numAckedSessions;
+    };
+
     ExecuteForAllContext([&](ReliableMessageContext * rc) {
         if (rc->IsAckPending())
         {
@@ -117,15 +163,40 @@ void ReliableMessageMgr::ExecuteActions()
 #if defined(RMP_TICKLESS_DEBUG)
                 ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
 #endif
+                const Transport::Session * session = GetAckSession(rc->GetExchangeContext());
+                if (mAckCoalescingWindow > System::Clock::kZero && session != nullptr &&
+                    numAckedSessions < ArraySize(ackedSessions) && !isAckedSession(session))
+                {
+                    ackedSessions[numAckedSessions++] = session;
+                }
                 rc->SendStandaloneAckMessage();
             }
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Acks for different exchanges cannot be merged, but the ones towards the same peers that are about to be due can be sent
+    // now, rather than each on a wakeup of its own.
+    if (numAckedSessions > 0)
+    {
+        ExecuteForAllContext([&](ReliableMessageContext * rc) {
+            if (rc->IsAckPending() && rc->mNextAckTime <= now + mAckCoalescingWindow &&
+                isAckedSession(GetAckSession(rc->GetExchangeContext())))
+            {
+                mAckStats.mCoalescedStandaloneAcks++;
+                rc->SendStandaloneAckMessage();
+            }
+        });
+    }
+
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired.  The due entries are taken out of
+    // the timer heap first, so that each of them is handled once even if its next retransmission time is already due.
+    CollectDueEntries(now);
+    while (mDueEntries != nullptr)
+    {
+        RetransTableEntry * entry = mDueEntries;
+        mDueEntries               = entry->nextDue;
+        entry->nextDue            = nullptr;
+        entry->timerSlot          = RetransTableEntry::kTimerNotScheduled;
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -168,12 +239,14 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransTableEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
+        entry->lastSendTime = now;
+        mRetransmissionStats.mRetransmissions++;
 
         ChipLogProgress(ExchangeManager,
                         "<<%d [E:" ChipLogFormatExchange " S:%u M:" ChipLogFormatMessageCounter
@@ -181,12 +254,11 @@ void ReliableMessageMgr::ExecuteActions()
                         entry->sendCount, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
                         Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
+        MATTER_TRACE_COUNTER("MRPRetransmissions");
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -219,6 +291,7 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    mRetransTableIndex.Add(RetransTableIndexKey((*rEntry)->ec.Get()), *rEntry);
     return CHIP_NO_ERROR;
 }
 
@@ -285,30 +358,73 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+    entry->lastSendTime = System::SystemClock().GetMonotonicTimestamp();
     CalculateNextRetransTime(*entry);
     StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
+    RetransTableEntry * entry = FindRetransTableEntry(rc);
+    VerifyOrReturnValue(entry != nullptr && entry->retainedBuf.GetMessageCounter() == ackMessageCounter, false);
+
+    OnAcknowledged(*entry);
+
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
+
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
+}
+
+void ReliableMessageMgr::OnAcknowledged(const RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.ec->HasSessionHandle() && entry.ec->GetSessionHandle()->IsSecureSession());
+
+    auto & estimator     = entry.ec->GetSessionHandle()->AsSecureSession()->GetRoundTripTimeEstimator();
+    const auto sinceSent = System::SystemClock().GetMonotonicTimestamp() - entry.lastSendTime;
+    const auto elapsed   = std::chrono::duration_cast<System::Clock::Milliseconds32>(sinceSent);
+
+    if (entry.sendCount == 0)
+    {
+        estimator.AddSample(elapsed);
+        return;
+    }
+
+    // Karn's rule: there is no telling which transmission is acknowledged, so there is no sample.  But an acknowledgment that
+    // comes faster than any round trip ever measured cannot be for the last retransmission, which was then not needed.
+    if (estimator.HasEstimate() && elapsed < estimator.GetMinRtt())
+    {
+        mRetransmissionStats.mSpuriousRetransmissions++;
+    }
+    else
+    {
+        mRetransmissionStats.mNeededRetransmissions++;
+    }
+}
+
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::FindRetransTableEntry(ReliableMessageContext * rc)
+{
+    auto belongsToContext = [rc](RetransTableEntry * entry) { return entry->ec->GetReliableMessageContext() == rc; };
+
+    RetransTableEntry * found = mRetransTableIndex.Find(RetransTableIndexKey(*rc->GetExchangeContext()), belongsToContext);
+    if (found != nullptr || mRetransTableIndex.IsComplete())
+    {
+        return found;
+    }
+
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
+        if (belongsToContext(entry))
         {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
+            found = entry;
             return Loop::Break;
         }
         return Loop::Continue;
     });
-
-    return removed;
+    return found;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -367,23 +483,157 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = FindRetransTableEntry(rc);
+    if (entry != nullptr)
+    {
+        ClearRetransTable(*entry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransTableEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransTableEntry(RetransTableEntry & entry)
+{
+    UnscheduleRetransmission(entry);
+    mRetransTableIndex.Remove(RetransTableIndexKey(entry.ec.Get()), &entry);
+    mRetransTable.ReleaseObject(&entry);
+}
+
+void ReliableMessageMgr::ScheduleRetransmission(RetransTableEntry & entry)
+{
+    UnscheduleRetransmission(entry);
+
+    if (mTimerHeapSize == ArraySize(mTimerHeap))
+    {
+        entry.timerSlot = RetransTableEntry::kTimerNotInHeap;
+        mNumTimersNotInHeap++;
+        return;
+    }
+
+    SetTimerSlot(&entry, mTimerHeapSize++);
+    SiftUp(entry.timerSlot);
+}
+
+void ReliableMessageMgr::UnscheduleRetransmission(RetransTableEntry & entry)
+{
+    if (entry.timerSlot < mTimerHeapSize)
+    {
+        // Move the last entry of the heap into the freed slot, then restore the heap order.
+        const size_t slot        = entry.timerSlot;
+        RetransTableEntry * last = mTimerHeap[--mTimerHeapSize];
+        if (last != &entry)
+        {
+            SetTimerSlot(last, slot);
+            SiftDown(slot);
+            SiftUp(last->timerSlot);
+        }
+    }
+    else if (entry.timerSlot == RetransTableEntry::kTimerNotInHeap)
+    {
+        mNumTimersNotInHeap--;
+    }
+    else if (entry.timerSlot == RetransTableEntry::kTimerDue)
+    {
+        RetransTableEntry ** link = &mDueEntries;
+        while (*link != &entry)
+        {
+            link = &(*link)->nextDue;
+        }
+        *link         = entry.nextDue;
+        entry.nextDue = nullptr;
+    }
+
+    entry.timerSlot = RetransTableEntry::kTimerNotScheduled;
+}
+
+void ReliableMessageMgr::CollectDueEntries(System::Clock::Timestamp now)
+{
+    RetransTableEntry ** tail = &mDueEntries;
+    while (*tail != nullptr)
+    {
+        tail = &(*tail)->nextDue;
+    }
+
+    auto appendDue = [&tail](RetransTableEntry * entry) {
+        entry->timerSlot = RetransTableEntry::kTimerDue;
+        entry->nextDue   = nullptr;
+        *tail            = entry;
+        tail             = &entry->nextDue;
+    };
+
+    while (mTimerHeapSize > 0 && mTimerHeap[0]->nextRetransTime <= now)
+    {
+        RetransTableEntry * entry = mTimerHeap[0];
+        UnscheduleRetransmission(*entry);
+        appendDue(entry);
+    }
+
+    if (mNumTimersNotInHeap > 0)
+    {
+        mRetransTable.ForEachActiveObject([&](auto * entry) {
+            if (entry->timerSlot == RetransTableEntry::kTimerNotInHeap && entry->nextRetransTime <= now)
+            {
+                UnscheduleRetransmission(*entry);
+                appendDue(entry);
+            }
+            return Loop::Continue;
+        });
+    }
+}
+
+void ReliableMessageMgr::SiftUp(size_t slot)
+{
+    while (slot > 0)
+    {
+        const size_t parent = (slot - 1) / 2;
+        if (mTimerHeap[parent]->nextRetransTime <= mTimerHeap[slot]->nextRetransTime)
+        {
+            break;
+        }
+        RetransTableEntry * entry = mTimerHeap[slot];
+        SetTimerSlot(mTimerHeap[parent], slot);
+        SetTimerSlot(entry, parent);
+        slot = parent;
+    }
+}
+
+void ReliableMessageMgr::SiftDown(size_t slot)
+{
+    while (true)
+    {
+        size_t smallest    = slot;
+        const size_t left  = 2 * slot + 1;
+        const size_t right = left + 1;
+        if (left < mTimerHeapSize && mTimerHeap[left]->nextRetransTime < mTimerHeap[smallest]->nextRetransTime)
+        {
+            smallest = left;
+        }
+        if (right < mTimerHeapSize && mTimerHeap[right]->nextRetransTime < mTimerHeap[smallest]->nextRetransTime)
+        {
+            smallest = right;
+        }
+        if (smallest == slot)
+        {
+            break;
+        }
+        RetransTableEntry * entry = mTimerHeap[slot];
+        SetTimerSlot(mTimerHeap[smallest], slot);
+        SetTimerSlot(entry, smallest);
+        slot = smallest;
+    }
+}
+
+void ReliableMessageMgr::SetTimerSlot(RetransTableEntry * entry, size_t slot)
+{
+    mTimerHeap[slot] = entry;
+    entry->timerSlot = slot;
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -397,13 +647,20 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mTimerHeapSize > 0 && mTimerHeap[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mTimerHeap[0]->nextRetransTime;
+    }
+    if (mNumTimersNotInHeap > 0)
+    {
+        mRetransTable.ForEachActiveObject([&](auto * entry) {
+            if (entry->timerSlot == RetransTableEntry::kTimerNotInHeap && entry->nextRetransTime < nextWakeTime)
+            {
+                nextWakeTime = entry->nextRetransTime;
+            }
+            return Loop::Continue;
+        });
+    }
 
     StopTimer();
 
@@ -491,8 +748,17 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = sessionHandle->GetMRPBaseTimeout();
     }
 
+    if (sAdaptiveRetransTimeout && sessionHandle->IsSecureSession())
+    {
+        const auto * secureSession = sessionHandle->AsSecureSession();
+        const bool peerIsActive    = entry.ec->HasReceivedAtLeastOneMessage() || secureSession->IsPeerActive();
+        baseTimeout                = GetAdaptiveBaseTimeout(baseTimeout, peerIsActive, secureSession->GetRemoteMRPConfig(),
+                                                            secureSession->GetRoundTripTimeEstimator());
+    }
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    ScheduleRetransmission(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -66,6 +67,40 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+
+    private:
+        friend class ReliableMessageMgr;
+
+        static constexpr size_t kTimerNotScheduled = SIZE_MAX;     /**< No retransmission scheduled. */
+        static constexpr size_t kTimerDue          = SIZE_MAX - 1; /**< Due, waiting to be handled by ExecuteActions. */
+        static constexpr size_t kTimerNotInHeap    = SIZE_MAX - 2; /**< Scheduled, but the timer heap was full. */
+
+        size_t timerSlot           = kTimerNotScheduled; /**< Position in the timer heap, or one of the states above. */
+        RetransTableEntry * nextDue = nullptr;           /**< Next entry in the list of due entries. */
+        System::Clock::Timestamp lastSendTime;           /**< When the message was last (re)transmitted. */
+    };
+
+    /**
+     *  Counters of retransmissions.  A retransmitted message is classified as needing it or not once it gets acknowledged.
+     */
+    struct RetransmissionStats
+    {
+        uint32_t mRetransmissions         = 0; /**< Number of retransmissions sent. */
+        uint32_t mNeededRetransmissions   = 0; /**< Acknowledged messages that had been lost before being retransmitted. */
+        uint32_t mSpuriousRetransmissions = 0; /**< Acknowledged messages that had been retransmitted although they were not
+                                                    lost, because the acknowledgment came too soon after the last retransmission
+                                                    to be for it. */
+    };
+
+    /**
+     *  Counters of the acknowledgments sent.
+     */
+    struct AckStats
+    {
+        uint32_t mPiggybackedAcks         = 0; /**< Acks carried by another message of their exchange, saving a standalone ack. */
+        uint32_t mStandaloneAcks          = 0; /**< Standalone acks sent. */
+        uint32_t mCoalescedStandaloneAcks = 0; /**< Standalone acks sent ahead of their deadline, along with a due standalone ack
+                                                    to the same peer. */
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -221,7 +256,63 @@ public:
      */
     static void SetAdditionalMRPBackoffTime(const Optional<System::Clock::Timeout> & additionalTime);
 
+    /**
+     * Set whether the retransmission timeout of messages sent to an active peer
+     * over a secure session is derived from the round-trip time measured on that
+     * session, when that is longer than the active interval advertised by the peer.
+     *
+     * The measured timeout is bounded below by the active interval advertised by
+     * the peer and CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL, and above by the
+     * idle interval advertised by the peer.  The usual backoff still applies to
+     * it.  Messages to a peer that may be idle always use its idle interval.
+     *
+     * Defaults to CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL.  This is a static for
+     * the same reason as SetAdditionalMRPBackoffTime.
+     */
+    static void SetAdaptiveRetransTimeout(bool enabled) { sAdaptiveRetransTimeout = enabled; }
+    static bool IsAdaptiveRetransTimeoutEnabled() { return sAdaptiveRetransTimeout; }
+
+    const RetransmissionStats & GetRetransmissionStats() const { return mRetransmissionStats; }
+    void ResetRetransmissionStats() { mRetransmissionStats = RetransmissionStats(); }
+
+    /**
+     * Set how long before its deadline a pending standalone ack is sent along with a standalone ack that is
+     * due on another exchange over the same session.
+     *
+     * An ack can only be piggybacked on a message of its own exchange, so acks for several exchanges cannot be
+     * merged into one message.  But sending the acks towards a peer in one go takes a single timer wakeup (and,
+     * for a sleepy device, a single radio wakeup) rather than one per exchange, at the cost of giving up on
+     * piggybacking them for at most the window.
+     *
+     * Defaults to CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW.  Zero disables coalescing.
+     */
+    void SetAckCoalescingWindow(System::Clock::Timeout window) { mAckCoalescingWindow = window; }
+
+    /**
+     * Account for an ack that was sent, either in a standalone ack or piggybacked on another message.
+     */
+    void CountAckSent(bool standalone)
+    {
+        if (standalone)
+        {
+            mAckStats.mStandaloneAcks++;
+        }
+        else
+        {
+            mAckStats.mPiggybackedAcks++;
+        }
+    }
+
+    const AckStats & GetAckStats() const { return mAckStats; }
+    void ResetAckStats() { mAckStats = AckStats(); }
+
 private:
+    /**
+     * Update the round-trip time estimate of the session and the retransmission stats for
+     * the acknowledgment of the message of entry.
+     */
+    void OnAcknowledged(const RetransTableEntry & entry);
+
     /**
      * Calculates the next retransmission time for the entry
      * Function sets the nextRetransTime of the entry
@@ -230,6 +321,25 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Find the entry of the exchange of rc, if any.
+     */
+    RetransTableEntry * FindRetransTableEntry(ReliableMessageContext * rc);
+
+    /**
+     * Release an entry, taking it out of the timer heap and the exchange index.
+     */
+    void ReleaseRetransTableEntry(RetransTableEntry & entry);
+
+    // Timer heap management: the scheduled entries are kept in a binary min-heap ordered by nextRetransTime, so that finding
+    // the next wakeup time and the due entries does not require walking the whole retransmission table.
+    void ScheduleRetransmission(RetransTableEntry & entry);
+    void UnscheduleRetransmission(RetransTableEntry & entry);
+    void CollectDueEntries(System::Clock::Timestamp now);
+    void SiftUp(size_t slot);
+    void SiftDown(size_t slot);
+    void SetTimerSlot(RetransTableEntry * entry, size_t slot);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -248,9 +358,26 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Entries of mRetransTable indexed by exchange (each exchange has at most one entry), to match acks in constant time.
+    HashIndex<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTableIndex;
+
+    // Min-heap of the scheduled entries.  Heap-allocated pools may hold more entries than this: those are counted in
+    // mNumTimersNotInHeap, and found by walking mRetransTable.
+    RetransTableEntry * mTimerHeap[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t mTimerHeapSize      = 0;
+    size_t mNumTimersNotInHeap = 0;
+
+    // Entries whose retransmission time has come, while ExecuteActions handles them.
+    RetransTableEntry * mDueEntries = nullptr;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
+    RetransmissionStats mRetransmissionStats;
+    AckStats mAckStats;
+    System::Clock::Timeout mAckCoalescingWindow;
+
     static System::Clock::Timeout sAdditionalMRPBackoffTime;
+    static bool sAdaptiveRetransTimeout;
 };
 
 } // namespace Messaging
@@ -183,6 +183,49 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Whether the retransmission timeout of messages sent to an active peer
+ *    over a secure session is, by default, derived from the round-trip time
+ *    measured on that session when that is longer than the active interval
+ *    that the peer advertises.  Can be changed at runtime with
+ *    ReliableMessageMgr::SetAdaptiveRetransTimeout.
+ *
+ *  The measured timeout is bounded below by the active interval advertised by
+ *  the peer and CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL, and above by the
+ *  idle interval advertised by the peer.  Messages to a peer that may be idle
+ *  always use its idle interval.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+ *
+ *  @brief
+ *    The lower bound of the retransmission timeout derived from the measured
+ *    round-trip time, see CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL (100_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+ *
+ *  @brief
+ *    The default for ReliableMessageMgr::SetAckCoalescingWindow: how long
+ *    before its deadline a pending standalone ack may be sent, along with a
+ *    standalone ack that is due on another exchange to the same peer.  Zero
+ *    disables the coalescing of standalone acks.
+ */
+#ifndef CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+#define CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW (0_ms32)
+#endif // CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
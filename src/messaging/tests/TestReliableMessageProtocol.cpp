@@ -171,6 +171,36 @@ private:
     bool mDropAckResponse = false;
 };
 
+class MockRetainingReceiver : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    // Every request takes an exchange on both the sender and the receiver side.
+    static constexpr size_t kMaxExchanges = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2;
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        // Keep every exchange open, so that its ack stays pending until we respond or the ack timer fires.
+        if (mNumExchanges < kMaxExchanges)
+        {
+            ec->WillSendMessage();
+            mExchanges[mNumExchanges++] = ec;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * mExchanges[kMaxExchanges] = {};
+    size_t mNumExchanges                        = 0;
+};
+
 class MockSessionEstablishmentExchangeDispatch : public Messaging::ApplicationExchangeDispatch
 {
 public:
@@ -563,6 +593,205 @@ TEST_F(TestReliableMessageProtocol, CheckCloseExchangeAndResendApplicationMessag
     EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
 }
 
+TEST_F(TestReliableMessageProtocol, CheckResendOnManyExchanges)
+{
+    constexpr size_t kNumExchanges = 4;
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Let's drop the initial message of every exchange
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kNumExchanges;
+    loopback.mDroppedMessageCount = 0;
+
+    // Ensure the retransmit table is empty right now
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (size_t i = 0; i < kNumExchanges; i++)
+    {
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        exchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+            64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+            64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+        }));
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        EXPECT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+
+    // Ensure the messages were dropped, and were added to retransmit table
+    EXPECT_EQ(loopback.mNumMessagesToDrop, 0u);
+    EXPECT_EQ(loopback.mDroppedMessageCount, kNumExchanges);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges));
+
+    // Wait for every message to be retransmitted once (should take 64ms), and acknowledged
+    GetIOContext().DriveIOUntil(2000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_GE(loopback.mSentMessageCount, 2 * kNumExchanges);
+    EXPECT_EQ(loopback.mDroppedMessageCount, kNumExchanges);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
+TEST_F(TestReliableMessageProtocol, CheckAdaptiveRetransTimeout)
+{
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+    rm->ResetRetransmissionStats();
+
+    auto * session = GetSessionBobToAlice()->AsSecureSession();
+    // The peer's active interval is above CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL, and far above the loopback round trip.
+    session->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        300_ms32,  // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    EXPECT_FALSE(session->GetRoundTripTimeEstimator().HasEstimate());
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+
+    // A message acknowledged on its first transmission gives a round-trip time sample.
+    ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(session->GetRoundTripTimeEstimator().GetSampleCount(), 1u);
+    EXPECT_EQ(rm->GetRetransmissionStats().mRetransmissions, 0u);
+
+    // The measured (loopback) round-trip time is shorter than the active interval advertised by the peer, so even with the
+    // adaptive timeout a lost message is retransmitted only after that interval, and well before the idle interval.
+    ReliableMessageMgr::SetAdaptiveRetransTimeout(true);
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 1;
+    loopback.mDroppedMessageCount = 0;
+
+    exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    EXPECT_FALSE(buffer.IsNull());
+
+    const System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(loopback.mDroppedMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    GetIOContext().DriveIOUntil(2000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    const System::Clock::Timeout completionTime = System::SystemClock().GetMonotonicTimestamp() - startTime;
+    ChipLogProgress(Test, "Lost message acknowledged after %" PRIu32 "ms", static_cast<uint32_t>(completionTime.count()));
+    DrainAndServiceIO();
+
+    ReliableMessageMgr::SetAdaptiveRetransTimeout(CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL);
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_GE(completionTime, 300_ms32);
+    EXPECT_LT(completionTime, 1000_ms32);
+
+    // The retransmitted message does not give a sample (Karn's rule), but is counted.
+    EXPECT_EQ(session->GetRoundTripTimeEstimator().GetSampleCount(), 1u);
+    const auto & stats = rm->GetRetransmissionStats();
+    EXPECT_EQ(stats.mRetransmissions, 1u);
+    EXPECT_EQ(stats.mNeededRetransmissions + stats.mSpuriousRetransmissions, 1u);
+}
+
+TEST_F(TestReliableMessageProtocol, CheckStandaloneAckCoalescing)
+{
+    constexpr size_t kNumExchanges = MockRetainingReceiver::kMaxExchanges;
+    constexpr size_t kBatchSize    = kNumExchanges / 2;
+
+    MockAppDelegate mockSender(*this);
+    MockRetainingReceiver mockReceiver;
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+    ASSERT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver),
+              CHIP_NO_ERROR);
+
+    // Make sure nothing gets retransmitted (and acked again) while acks are pending.
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    rm->SetAckCoalescingWindow(100_ms32);
+    rm->ResetAckStats();
+
+    ExchangeContext * senders[kNumExchanges];
+    auto sendRequests = [&](size_t first) {
+        for (size_t i = first; i < first + kBatchSize; i++)
+        {
+            senders[i] = NewExchangeToAlice(&mockSender);
+            ASSERT_NE(senders[i], nullptr);
+            chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            EXPECT_FALSE(buffer.IsNull());
+            EXPECT_EQ(senders[i]->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse),
+                      CHIP_NO_ERROR);
+        }
+        DrainAndServiceIO();
+    };
+
+    // Two batches of concurrent requests, whose standalone acks are due 50ms apart.
+    sendRequests(0);
+    GetIOContext().DriveIOUntil(50_ms32, [] { return false; });
+    const System::Clock::Timestamp secondBatchTime = System::SystemClock().GetMonotonicTimestamp();
+    sendRequests(kBatchSize);
+
+    ASSERT_EQ(mockReceiver.mNumExchanges, kNumExchanges);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges));
+
+    // Respond to every other request, piggybacking its ack.
+    for (size_t i = 0; i < kNumExchanges; i += 2)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        EXPECT_FALSE(buffer.IsNull());
+        EXPECT_EQ(mockReceiver.mExchanges[i]->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer),
+                                                          SendMessageFlags::kNoAutoRequestAck),
+                  CHIP_NO_ERROR);
+        mockReceiver.mExchanges[i] = nullptr;
+    }
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumExchanges / 2));
+    EXPECT_EQ(rm->GetAckStats().mPiggybackedAcks, kNumExchanges / 2);
+    EXPECT_EQ(rm->GetAckStats().mStandaloneAcks, 0u);
+
+    // The standalone acks of the second batch go out with the ones of the first batch, well before their own deadline.
+    GetIOContext().DriveIOUntil(1000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    const System::Clock::Timeout ackTime = System::SystemClock().GetMonotonicTimestamp() - secondBatchTime;
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_LT(ackTime, CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+    EXPECT_EQ(rm->GetAckStats().mStandaloneAcks, kNumExchanges / 2);
+    EXPECT_GE(rm->GetAckStats().mCoalescedStandaloneAcks, kBatchSize / 2);
+
+    rm->SetAckCoalescingWindow(CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW);
+    for (size_t i = 0; i < kNumExchanges; i++)
+    {
+        if (mockReceiver.mExchanges[i] != nullptr)
+        {
+            mockReceiver.mExchanges[i]->Close();
+        }
+        if (i % 2 != 0)
+        {
+            // The other exchanges were closed once they got their response.
+            senders[i]->Close();
+        }
+    }
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest), CHIP_NO_ERROR);
+}
+
 TEST_F(TestReliableMessageProtocol, CheckFailedMessageRetainOnSend)
 {
     chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
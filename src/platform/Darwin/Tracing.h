@@ -30,6 +30,12 @@
         os_signpost_event_emit(__DARWIN_MATTER_SIGNPOST_LOGGER(), OS_SIGNPOST_ID_EXCLUSIVE, label, "%u", ++count##_label); \
     } while (0)
 
+#define MATTER_TRACE_COUNTER_VALUE(label, value)                                                                           \
+    do {                                                                                                                   \
+        os_signpost_event_emit(__DARWIN_MATTER_SIGNPOST_LOGGER(), OS_SIGNPOST_ID_EXCLUSIVE, label, "%lld",                 \
+            static_cast<long long>(value));                                                                                \
+    } while (0)
+
 #define _CONCAT_IMPL(a, b) a##b
 #define _MACRO_CONCAT(a, b) _CONCAT_IMPL(a, b)
 
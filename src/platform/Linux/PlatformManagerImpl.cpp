@@ -44,6 +44,8 @@
 #include <platform/Linux/DiagnosticDataProviderImpl.h>
 #include <platform/PlatformManager.h>
 #include <platform/internal/GenericPlatformManagerImpl_POSIX.ipp>
+#include <system/SystemEventLoopStats.h>
+#include <tracing/metric_event.h>
 
 using namespace ::chip::app::Clusters;
 
@@ -54,6 +56,14 @@ PlatformManagerImpl PlatformManagerImpl::sInstance;
 
 namespace {
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+void ReportLongEventLoopTask(const System::EventLoopStats::LongTask & task)
+{
+    MATTER_LOG_METRIC(Tracing::kMetricEventLoopLongTask,
+                      std::chrono::duration_cast<System::Clock::Milliseconds32>(task.runTime).count());
+}
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
 #if CHIP_DEVICE_CONFIG_WITH_GLIB_MAIN_LOOP
 void * GLibMainLoopThread(void * userData)
 {
@@ -246,6 +256,10 @@ CHIP_ERROR PlatformManagerImpl::_InitChipStack()
 
     mStartTime = System::SystemClock().GetMonotonicTimestamp();
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+    System::GetEventLoopStats().SetLongTaskHandler(ReportLongEventLoopTask);
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
     return CHIP_NO_ERROR;
 }
 
@@ -1981,7 +1981,8 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
 
         // Copy remaining needed data into work structure
         {
-            data.validContext = mValidContext;
+            data.validContext                 = mValidContext;
+            data.validContext.mSignatureCache = mFabricsTable->GetCertificateSignatureCache();
 
             // initiatorNOC and initiatorICAC are spans into msg_R3_Encrypted
             // which is going away, so to save memory, redirect them to their
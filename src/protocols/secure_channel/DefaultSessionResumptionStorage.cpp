@@ -20,12 +20,14 @@
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
 
+#include <algorithm>
+
 namespace chip {
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
-    ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+    ReturnErrorOnFailure(CachedLoadState(node, resumptionId, sharedSecret, peerCATs));
     return CHIP_NO_ERROR;
 }
 
@@ -42,7 +44,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
-    ReturnErrorOnFailure(LoadLink(resumptionId, node));
+    ReturnErrorOnFailure(CachedLoadLink(resumptionId, node));
     return CHIP_NO_ERROR;
 }
 
@@ -50,7 +52,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
     SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(CachedLoadIndex(index));
 
     for (size_t i = 0; i < index.mSize; ++i)
     {
@@ -65,7 +67,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
             // resumption-id-keyed link is best effort.  If we cannot load
             // state to lookup the resumption ID for the key, the entry in
             // the link table will be leaked.
-            err = LoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
+            err = CachedLoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(SecureChannel,
@@ -84,7 +86,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
                                  ChipLogValueX64(node.GetNodeId()), err.Format());
                 }
             }
-            ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+            ReturnErrorOnFailure(CachedSaveState(node, resumptionId, sharedSecret, peerCATs));
             ReturnErrorOnFailure(SaveLink(resumptionId, node));
             return CHIP_NO_ERROR;
         }
@@ -92,16 +94,15 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
 
     if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
     {
-        // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        ReturnErrorOnFailure(Delete(index.mNodes[LeastRecentlyUsed(index)]));
+        ReturnErrorOnFailure(CachedLoadIndex(index));
     }
 
-    ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+    ReturnErrorOnFailure(CachedSaveState(node, resumptionId, sharedSecret, peerCATs));
     ReturnErrorOnFailure(SaveLink(resumptionId, node));
 
     index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
+    ReturnErrorOnFailure(CachedSaveIndex(index));
 
     return CHIP_NO_ERROR;
 }
@@ -109,12 +110,12 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
 CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 {
     SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(CachedLoadIndex(index));
 
     ResumptionIdStorage resumptionId;
     Crypto::P256ECDHDerivedSecret sharedSecret;
     CATValues peerCATs;
-    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    CHIP_ERROR err = CachedLoadState(node, resumptionId, sharedSecret, peerCATs);
     if (err == CHIP_NO_ERROR)
     {
         err = DeleteLink(resumptionId);
@@ -133,7 +134,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
                      ChipLogValueX64(node.GetNodeId()), err.Format());
     }
 
-    err = DeleteState(node);
+    err = CachedDeleteState(node);
     if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
     {
         ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
@@ -165,7 +166,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 
     if (found)
     {
-        err = SaveIndex(index);
+        err = CachedSaveIndex(index);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
@@ -186,7 +187,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     CHIP_ERROR stickyErr = CHIP_NO_ERROR;
     size_t found         = 0;
     SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(CachedLoadIndex(index));
     size_t initialSize = index.mSize;
     for (size_t i = 0; i < initialSize; ++i)
     {
@@ -200,7 +201,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
         {
             continue;
         }
-        err       = LoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
+        err       = CachedLoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -220,7 +221,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
                          fabricIndex, err.Format());
             continue;
         }
-        err       = DeleteState(index.mNodes[cur]);
+        err       = CachedDeleteState(index.mNodes[cur]);
         stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -240,7 +241,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     if (found)
     {
         index.mSize -= found;
-        CHIP_ERROR err = SaveIndex(index);
+        CHIP_ERROR err = CachedSaveIndex(index);
         stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
         if (err != CHIP_NO_ERROR)
         {
@@ -254,4 +255,197 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     return stickyErr;
 }
 
+void DefaultSessionResumptionStorage::ResetCache()
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    mIndexCached = false;
+    while (mStateCount > 0)
+    {
+        RemoveCachedState(mStates[0].mNode);
+    }
+    mUsageClock = 0;
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+size_t DefaultSessionResumptionStorage::LeastRecentlyUsed(const SessionIndex & index)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    size_t victim   = 0;
+    uint32_t oldest = UINT32_MAX;
+    for (size_t i = 0; i < index.mSize; ++i)
+    {
+        const CachedState * state = FindCachedState(index.mNodes[i]);
+        const uint32_t lastUsed   = (state != nullptr) ? state->mLastUsed : 0;
+        if (lastUsed < oldest)
+        {
+            victim = i;
+            oldest = lastUsed;
+        }
+    }
+    return victim;
+#else
+    // Without usage information, the oldest entry goes.
+    return 0;
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedSaveIndex(const SessionIndex & index)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    // If the write fails, what is in storage is unknown: read it again next time.
+    mIndexCached = false;
+    ReturnErrorOnFailure(SaveIndex(index));
+    mIndex       = index;
+    mIndexCached = true;
+    return CHIP_NO_ERROR;
+#else
+    return SaveIndex(index);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedLoadIndex(SessionIndex & index)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    if (!mIndexCached)
+    {
+        ReturnErrorOnFailure(LoadIndex(mIndex));
+        mIndexCached = true;
+    }
+    index = mIndex;
+    return CHIP_NO_ERROR;
+#else
+    return LoadIndex(index);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedLoadLink(ConstResumptionIdView resumptionId, ScopedNodeId & node)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    // The link table is the reverse of the state table: a cached state is as good as its link.
+    for (size_t i = 0; i < mStateCount; ++i)
+    {
+        const ResumptionIdStorage & cachedId = mStates[i].mResumptionId;
+        if (std::equal(cachedId.begin(), cachedId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            node = mStates[i].mNode;
+            return CHIP_NO_ERROR;
+        }
+    }
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    return LoadLink(resumptionId, node);
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedSaveState(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                            const Crypto::P256ECDHDerivedSecret & sharedSecret,
+                                                            const CATValues & peerCATs)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    CHIP_ERROR err = SaveState(node, resumptionId, sharedSecret, peerCATs);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Storage may hold either the old or the new state.
+        RemoveCachedState(node);
+        return err;
+    }
+
+    CachedState & state = AllocateCachedState(node);
+    std::copy(resumptionId.begin(), resumptionId.end(), state.mResumptionId.begin());
+    state.mSharedSecret = sharedSecret;
+    state.mPeerCATs     = peerCATs;
+    return CHIP_NO_ERROR;
+#else
+    return SaveState(node, resumptionId, sharedSecret, peerCATs);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedLoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                                            Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    CachedState * state = FindCachedState(node);
+    if (state == nullptr)
+    {
+        ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+        state                = &AllocateCachedState(node);
+        state->mResumptionId = resumptionId;
+        state->mSharedSecret = sharedSecret;
+        state->mPeerCATs     = peerCATs;
+        return CHIP_NO_ERROR;
+    }
+
+    state->mLastUsed = ++mUsageClock;
+    resumptionId     = state->mResumptionId;
+    sharedSecret     = state->mSharedSecret;
+    peerCATs         = state->mPeerCATs;
+    return CHIP_NO_ERROR;
+#else
+    return LoadState(node, resumptionId, sharedSecret, peerCATs);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::CachedDeleteState(const ScopedNodeId & node)
+{
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    RemoveCachedState(node);
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    return DeleteState(node);
+}
+
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+DefaultSessionResumptionStorage::CachedState * DefaultSessionResumptionStorage::FindCachedState(const ScopedNodeId & node)
+{
+    for (size_t i = 0; i < mStateCount; ++i)
+    {
+        if (mStates[i].mNode == node)
+        {
+            return &mStates[i];
+        }
+    }
+    return nullptr;
+}
+
+DefaultSessionResumptionStorage::CachedState & DefaultSessionResumptionStorage::AllocateCachedState(const ScopedNodeId & node)
+{
+    CachedState * state = FindCachedState(node);
+    if (state == nullptr)
+    {
+        if (mStateCount < ArraySize(mStates))
+        {
+            state = &mStates[mStateCount++];
+        }
+        else
+        {
+            // Only states that are not in the index can get us here: replace the least recently used one.
+            state = &mStates[0];
+            for (auto & candidate : mStates)
+            {
+                if (candidate.mLastUsed < state->mLastUsed)
+                {
+                    state = &candidate;
+                }
+            }
+        }
+        state->mNode = node;
+    }
+
+    state->mLastUsed = ++mUsageClock;
+    return *state;
+}
+
+void DefaultSessionResumptionStorage::RemoveCachedState(const ScopedNodeId & node)
+{
+    CachedState * state = FindCachedState(node);
+    VerifyOrReturn(state != nullptr);
+
+    CachedState & last = mStates[--mStateCount];
+    if (state != &last)
+    {
+        *state = last;
+    }
+    Crypto::ClearSecretData(last.mSharedSecret.Bytes(), last.mSharedSecret.Capacity());
+    last.mSharedSecret.SetLength(0);
+    last.mNode = ScopedNodeId();
+}
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+
 } // namespace chip
@@ -29,6 +29,10 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   With CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE, the index and the states are also kept in memory,
+ *   so that lookups only go to storage for records that are not known yet, and the least recently used
+ *   entry is evicted when the index is full (rather than the oldest one).
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -54,6 +58,11 @@ public:
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
 protected:
+    /**
+     * Drops everything that was read from storage, e.g. because the storage itself changed.
+     */
+    void ResetCache();
+
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
 
@@ -66,6 +75,43 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    // The storage accessors above, through the cache when there is one.
+    CHIP_ERROR CachedSaveIndex(const SessionIndex & index);
+    CHIP_ERROR CachedLoadIndex(SessionIndex & index);
+    CHIP_ERROR CachedLoadLink(ConstResumptionIdView resumptionId, ScopedNodeId & node);
+    CHIP_ERROR CachedSaveState(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                               const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs);
+    CHIP_ERROR CachedLoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                               Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs);
+    CHIP_ERROR CachedDeleteState(const ScopedNodeId & node);
+
+    // Which index entry to evict to make room for a new one.
+    size_t LeastRecentlyUsed(const SessionIndex & index);
+
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+    struct CachedState
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+        // When the state was last saved or looked up.  Not persisted: after a reboot, states that have not
+        // been used yet go first, in index order.
+        uint32_t mLastUsed;
+    };
+
+    CachedState * FindCachedState(const ScopedNodeId & node);
+    CachedState & AllocateCachedState(const ScopedNodeId & node);
+    void RemoveCachedState(const ScopedNodeId & node);
+
+    SessionIndex mIndex;
+    bool mIndexCached = false;
+    CachedState mStates[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    size_t mStateCount   = 0;
+    uint32_t mUsageClock = 0;
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
 };
 
 } // namespace chip
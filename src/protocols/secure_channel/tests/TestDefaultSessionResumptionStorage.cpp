@@ -61,9 +61,8 @@ TEST(TestDefaultSessionResumptionStorage, TestSave)
 
     // Verify behavior for over-fill.
     //
-    // Currently, DefaultSessionResumptionStorage replaces index 0.
-    // If more sophisticated LRU behavior is implemented, this test
-    // case should be modified to match.
+    // DefaultSessionResumptionStorage replaces the least recently used
+    // entry, which is index 0 since nothing was looked up yet.
     {
         size_t last = ArraySize(vectors) - 1;
         EXPECT_EQ(
@@ -388,3 +387,73 @@ TEST(TestDefaultSessionResumptionStorage, TestDeleteAll)
         }
     }
 }
+
+TEST(TestDefaultSessionResumptionStorage, TestEvictionAndReload)
+{
+    chip::TestPersistentStorageDelegate storage;
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE + 1];
+
+    sharedSecret.SetLength(sharedSecret.Capacity());
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+    for (size_t i = 0; i < ArraySize(vectors); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()), CHIP_NO_ERROR);
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+        vectors[i].node                 = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), 1);
+    }
+
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+
+    {
+        chip::SimpleSessionResumptionStorage sessionStorage;
+        sessionStorage.Init(&storage);
+
+        for (size_t i = 0; i < CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE; ++i)
+        {
+            EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}),
+                      CHIP_NO_ERROR);
+        }
+
+        // Resuming with the oldest entry makes it the most recently used one.
+        EXPECT_EQ(sessionStorage.FindByResumptionId(vectors[0].resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, vectors[0].node);
+
+        size_t last = ArraySize(vectors) - 1;
+        EXPECT_EQ(sessionStorage.Save(vectors[last].node, vectors[last].resumptionId, sharedSecret, chip::CATValues{}),
+                  CHIP_NO_ERROR);
+
+#if CHIP_CONFIG_CASE_SESSION_RESUME_STORAGE_CACHE
+        const size_t evicted = 1;
+#else
+        const size_t evicted = 0;
+#endif
+        EXPECT_NE(sessionStorage.FindByResumptionId(vectors[evicted].resumptionId, outNode, outSharedSecret, outCats),
+                  CHIP_NO_ERROR);
+        EXPECT_NE(sessionStorage.FindByScopedNodeId(vectors[evicted].node, outResumptionId, outSharedSecret, outCats),
+                  CHIP_NO_ERROR);
+    }
+
+    // Everything that was saved is in storage: a new instance, e.g. after a reboot, finds the same records.
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    sessionStorage.Init(&storage);
+
+    size_t found = 0;
+    for (auto & vector : vectors)
+    {
+        if (sessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats) == CHIP_NO_ERROR)
+        {
+            EXPECT_EQ(outNode, vector.node);
+            EXPECT_EQ(memcmp(outSharedSecret.ConstBytes(), sharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+            found++;
+        }
+    }
+    EXPECT_EQ(found, static_cast<size_t>(CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE));
+}
@@ -523,6 +523,40 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 0
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the select based event loop records the run time and queue wait time of the
+ *      callbacks it runs (timers, scheduled work, socket handlers and, with the POSIX platform manager, device events), see
+ *      chip::System::EventLoopStats.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+#define CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS 0
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS
+ *
+ *  @brief
+ *      The number of distinct event loop callbacks that get their own run time statistics when
+ *      CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS is enabled. Further callbacks are accounted together.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS
+#define CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS 64
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EVENT_LOOP_LONG_TASK_THRESHOLD_MS
+ *
+ *  @brief
+ *      The default run time, in milliseconds, from which an event loop callback is reported as a long task when
+ *      CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EVENT_LOOP_LONG_TASK_THRESHOLD_MS
+#define CHIP_SYSTEM_CONFIG_EVENT_LOOP_LONG_TASK_THRESHOLD_MS 50
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_LONG_TASK_THRESHOLD_MS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_TEST
  *
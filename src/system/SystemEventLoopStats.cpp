@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file implements the statistics collected on the callbacks run by the event loop.
+ */
+
+#include <system/SystemEventLoopStats.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+EventLoopStats sEventLoopStats;
+
+} // namespace
+
+EventLoopStats & GetEventLoopStats()
+{
+    return sEventLoopStats;
+}
+
+const char * EventLoopStats::GetCallbackTypeName(CallbackType type)
+{
+    switch (type)
+    {
+    case CallbackType::kTimer:
+        return "timer";
+    case CallbackType::kSocket:
+        return "socket";
+    case CallbackType::kDeviceEvent:
+        return "device event";
+    }
+    return "unknown";
+}
+
+void EventLoopStats::Histogram::Add(Clock::Microseconds64 duration)
+{
+    size_t bucket = 0;
+    while ((bucket + 1 < kBucketCount) && (duration >= GetBucketLowerBound(bucket + 1)))
+    {
+        bucket++;
+    }
+
+    mBuckets[bucket]++;
+    mCount++;
+    mTotal += duration;
+    if (duration > mMax)
+    {
+        mMax = duration;
+    }
+}
+
+void EventLoopStats::Histogram::Reset()
+{
+    *this = Histogram();
+}
+
+Clock::Microseconds64 EventLoopStats::Histogram::GetBucketLowerBound(size_t bucket)
+{
+    // 0, 16us, 64us, 256us, ...
+    return (bucket == 0) ? Clock::kZero : Clock::Microseconds64(uint64_t(4) << (2 * bucket));
+}
+
+void EventLoopStats::RecordRunTime(CallbackType type, const void * callback, Clock::Microseconds64 runTime)
+{
+    CallbackStats * stats = FindOrAdd(type, callback);
+    stats->runTime.Add(runTime);
+
+    VerifyOrReturn(runTime >= mLongTaskThreshold);
+
+    ChipLogProgress(chipSystemLayer, "Event loop %s callback %p ran for %" PRIu32 " ms", GetCallbackTypeName(type), callback,
+                    std::chrono::duration_cast<Clock::Milliseconds32>(runTime).count());
+    if (mLongTaskHandler != nullptr)
+    {
+        mLongTaskHandler(LongTask{ *stats, runTime });
+    }
+}
+
+void EventLoopStats::Reset()
+{
+    mCallbackCount = 0;
+    mQueueWaitTime.Reset();
+}
+
+EventLoopStats::CallbackStats * EventLoopStats::FindOrAdd(CallbackType type, const void * callback)
+{
+    for (size_t i = 0; i < mCallbackCount; i++)
+    {
+        if ((mCallbacks[i].callback == callback) && (mCallbacks[i].type == type))
+        {
+            return &mCallbacks[i];
+        }
+    }
+
+    if (mCallbackCount < CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS)
+    {
+        CallbackStats & stats = mCallbacks[mCallbackCount++];
+        stats.callback        = callback;
+        stats.type            = type;
+        stats.runTime.Reset();
+        return &stats;
+    }
+
+    // Table full: account the callback with the others that did not fit
+    CallbackStats & others = mCallbacks[CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS];
+    if (mCallbackCount == CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS)
+    {
+        others.callback = nullptr;
+        others.runTime.Reset();
+        mCallbackCount++;
+    }
+    return &others;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,184 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file declares the statistics collected on the callbacks run by the event loop
+ *  (timers, scheduled work, socket handlers and device events). The event loop only
+ *  collects them when CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS is enabled.
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Run time and queue wait time statistics of the callbacks run by the event loop, used to find
+ * the callbacks that keep the Matter thread busy and delay everything else (e.g. reports).
+ *
+ * Run times are kept per callback function, so work scheduled through ScheduleLambda, which all
+ * goes through the same function, is accounted together. Queue wait time is the time between when
+ * a timer or scheduled work was due and when it started running.
+ *
+ * Only meant to be used from the Matter thread.
+ */
+class EventLoopStats
+{
+public:
+    enum class CallbackType : uint8_t
+    {
+        kTimer, // timers and scheduled work
+        kSocket,
+        kDeviceEvent, // events dispatched by the platform manager
+    };
+
+    static const char * GetCallbackTypeName(CallbackType type);
+
+    /**
+     * Histogram of durations, with buckets bounded by powers of 4 microseconds:
+     * < 16us, < 64us, < 256us, < 1024us, ..., < 262144us and >= 262144us (about 262ms).
+     */
+    class Histogram
+    {
+    public:
+        static constexpr size_t kBucketCount = 9;
+
+        void Add(Clock::Microseconds64 duration);
+        void Reset();
+
+        uint32_t GetCount() const { return mCount; }
+        uint32_t GetBucketCount(size_t bucket) const { return mBuckets[bucket]; }
+        Clock::Microseconds64 GetTotal() const { return mTotal; }
+        Clock::Microseconds64 GetMax() const { return mMax; }
+
+        /// Lower bound of the durations counted in `bucket`.
+        static Clock::Microseconds64 GetBucketLowerBound(size_t bucket);
+
+    private:
+        uint32_t mBuckets[kBucketCount] = {};
+        uint32_t mCount                 = 0;
+        Clock::Microseconds64 mTotal    = Clock::kZero;
+        Clock::Microseconds64 mMax      = Clock::kZero;
+    };
+
+    struct CallbackStats
+    {
+        /// The callback function (for device events, the work function, or the event type for events that
+        /// do not run one), or nullptr for the entry accounting all the callbacks that did not fit in the table.
+        const void * callback = nullptr;
+        CallbackType type     = CallbackType::kTimer;
+        Histogram runTime;
+    };
+
+    struct LongTask
+    {
+        const CallbackStats & callback;
+        Clock::Microseconds64 runTime;
+    };
+
+    /// Called for each callback that ran for longer than the long task threshold.
+    using LongTaskHandler = void (*)(const LongTask & task);
+
+    /**
+     * Measures the callback run in its scope. Does not measure anything when the statistics
+     * are disabled.
+     */
+    class CallbackScope
+    {
+    public:
+        CallbackScope(EventLoopStats & stats, CallbackType type, const void * callback) :
+            mStats(stats), mType(type), mCallback(callback)
+        {
+            if (stats.IsEnabled())
+            {
+                mMeasuring = true;
+                mStart     = SystemClock().GetMonotonicMicroseconds64();
+            }
+        }
+
+        ~CallbackScope()
+        {
+            if (mMeasuring)
+            {
+                mStats.RecordRunTime(mType, mCallback, SystemClock().GetMonotonicMicroseconds64() - mStart);
+            }
+        }
+
+        CallbackScope(const CallbackScope &)             = delete;
+        CallbackScope & operator=(const CallbackScope &) = delete;
+
+    private:
+        EventLoopStats & mStats;
+        CallbackType mType;
+        const void * mCallback;
+        bool mMeasuring              = false;
+        Clock::Microseconds64 mStart = Clock::kZero;
+    };
+
+    bool IsEnabled() const { return mEnabled; }
+    void SetEnabled(bool enabled) { mEnabled = enabled; }
+
+    Clock::Milliseconds32 GetLongTaskThreshold() const { return mLongTaskThreshold; }
+    void SetLongTaskThreshold(Clock::Milliseconds32 threshold) { mLongTaskThreshold = threshold; }
+
+    /// Long tasks are always logged; the handler can additionally export them (e.g. as metric events).
+    void SetLongTaskHandler(LongTaskHandler handler) { mLongTaskHandler = handler; }
+
+    void RecordRunTime(CallbackType type, const void * callback, Clock::Microseconds64 runTime);
+    void RecordQueueWait(Clock::Microseconds64 waitTime)
+    {
+        if (mEnabled)
+        {
+            mQueueWaitTime.Add(waitTime);
+        }
+    }
+
+    /// Run time statistics of the callbacks that ran since the last reset, in the order they first ran.
+    Span<const CallbackStats> GetCallbacks() const { return Span<const CallbackStats>(mCallbacks, mCallbackCount); }
+    const Histogram & GetQueueWaitTime() const { return mQueueWaitTime; }
+
+    void Reset();
+
+private:
+    CallbackStats * FindOrAdd(CallbackType type, const void * callback);
+
+    bool mEnabled                            = true;
+    Clock::Milliseconds32 mLongTaskThreshold = Clock::Milliseconds32(CHIP_SYSTEM_CONFIG_EVENT_LOOP_LONG_TASK_THRESHOLD_MS);
+    LongTaskHandler mLongTaskHandler         = nullptr;
+
+    // The last entry accounts for the callbacks that did not get their own.
+    CallbackStats mCallbacks[CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS + 1];
+    size_t mCallbackCount = 0;
+    Histogram mQueueWaitTime;
+};
+
+/**
+ * Statistics of the event loop of the system layer.
+ */
+EventLoopStats & GetEventLoopStats();
+
+} // namespace System
+} // namespace chip
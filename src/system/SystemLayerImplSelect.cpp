@@ -24,6 +24,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TimeUtils.h>
 #include <platform/LockTracker.h>
+#include <system/SystemEventLoopStats.h>
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 #include <system/SystemLayerImplSelect.h>
@@ -52,6 +53,21 @@ namespace System {
 
 constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
 
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+namespace {
+
+void RecordTimerQueueWait(EventLoopStats & stats, Clock::Timestamp awakenTime)
+{
+    VerifyOrReturn(stats.IsEnabled());
+
+    // Expired timers are extracted with a 1ms tolerance, so a timer may run slightly before it is due.
+    Clock::Timestamp now = SystemClock().GetMonotonicTimestamp();
+    stats.RecordQueueWait((now > awakenTime) ? Clock::Microseconds64(now - awakenTime) : Clock::kZero);
+}
+
+} // namespace
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+
 CHIP_ERROR LayerImplSelect::Init()
 {
     VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
@@ -740,6 +756,11 @@ void LayerImplSelect::HandleEvents()
     TimerList::Node * timer = nullptr;
     while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
     {
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+        RecordTimerQueueWait(GetEventLoopStats(), timer->AwakenTime());
+        EventLoopStats::CallbackScope scope(GetEventLoopStats(), EventLoopStats::CallbackType::kTimer,
+                                            reinterpret_cast<const void *>(timer->GetCallback().GetOnComplete()));
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
         mTimerPool.Invoke(timer);
     }
 
@@ -753,6 +774,10 @@ void LayerImplSelect::HandleEvents()
                 SocketEvents events = SocketEventsFromFDs(w.mFD, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
                 if (events.HasAny())
                 {
+#if CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
+                    EventLoopStats::CallbackScope scope(GetEventLoopStats(), EventLoopStats::CallbackType::kSocket,
+                                                        reinterpret_cast<const void *>(w.mCallback));
+#endif // CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS
                     w.mCallback(events, w.mCallbackData);
                 }
             }
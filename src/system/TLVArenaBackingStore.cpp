@@ -0,0 +1,199 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file contains a growable, heap-backed implementation of TLVBackingStore.
+ */
+
+#include <system/TLVArenaBackingStore.h>
+
+#include <algorithm>
+#include <string.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace System {
+
+size_t TLVArenaBackingStore::DataLength() const
+{
+    size_t length = 0;
+    for (const Chunk * chunk = mHead; chunk != nullptr; chunk = chunk->next)
+    {
+        length += chunk->length;
+    }
+    return length;
+}
+
+void TLVArenaBackingStore::Reset()
+{
+    while (mHead != nullptr)
+    {
+        Chunk * next = mHead->next;
+        Platform::MemoryFree(mHead);
+        mHead = next;
+    }
+    mTail      = nullptr;
+    mReadChunk = nullptr;
+}
+
+CHIP_ERROR TLVArenaBackingStore::AppendChunk(uint8_t *& bufStart, uint32_t & bufLen)
+{
+    uint32_t capacity = mInitialChunkSize;
+    if (mTail != nullptr)
+    {
+        capacity = std::min(mTail->capacity * 2, kMaxChunkSize);
+    }
+    capacity = std::max(capacity, static_cast<uint32_t>(1));
+
+    auto * chunk = static_cast<Chunk *>(Platform::MemoryAlloc(sizeof(Chunk) + capacity));
+    VerifyOrReturnError(chunk != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    chunk->next     = nullptr;
+    chunk->capacity = capacity;
+    chunk->length   = 0;
+
+    if (mTail == nullptr)
+    {
+        mHead = chunk;
+    }
+    else
+    {
+        mTail->next = chunk;
+    }
+    mTail = chunk;
+
+    bufStart = chunk->Data();
+    bufLen   = capacity;
+    return CHIP_NO_ERROR;
+}
+
+void TLVArenaBackingStore::ReadChunk(const Chunk * chunk, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    // Skip chunks with no data, since the reader treats an empty buffer as the end of the input.
+    while (chunk != nullptr && chunk->length == 0)
+    {
+        chunk = chunk->next;
+    }
+
+    mReadChunk = chunk;
+    bufStart   = (chunk != nullptr) ? chunk->Data() : nullptr;
+    bufLen     = (chunk != nullptr) ? chunk->length : 0;
+}
+
+CHIP_ERROR TLVArenaBackingStore::OnInit(chip::TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    ReadChunk(mHead, bufStart, bufLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVArenaBackingStore::GetNextBuffer(chip::TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen)
+{
+    ReadChunk((mReadChunk != nullptr) ? mReadChunk->next : nullptr, bufStart, bufLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVArenaBackingStore::OnInit(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    Reset();
+    return AppendChunk(bufStart, bufLen);
+}
+
+CHIP_ERROR TLVArenaBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
+{
+    return AppendChunk(bufStart, bufLen);
+}
+
+CHIP_ERROR TLVArenaBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen)
+{
+    // The writer only ever writes into the most recently appended chunk.
+    VerifyOrReturnError(mTail != nullptr && bufStart == mTail->Data(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(bufLen <= mTail->capacity, CHIP_ERROR_INVALID_ARGUMENT);
+    mTail->length = bufLen;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVArenaBackingStore::MoveToPacketBuffers(PacketBufferHandle & outBuffer, uint16_t reservedSize)
+{
+    VerifyOrReturnError(reservedSize < PacketBuffer::kMaxSizeWithoutReserve, CHIP_ERROR_INVALID_ARGUMENT);
+
+    PacketBufferHandle head;
+    const Chunk * chunk  = mHead;
+    uint32_t chunkOffset = 0;
+    size_t remaining     = DataLength();
+
+    do
+    {
+        const size_t available    = PacketBuffer::kMaxSizeWithoutReserve - (head.IsNull() ? reservedSize : 0);
+        PacketBufferHandle buffer = PacketBufferHandle::New(std::min(remaining, available), head.IsNull() ? reservedSize : 0);
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        const size_t bufferLen = std::min(remaining, buffer->AvailableDataLength());
+        size_t copied          = 0;
+        while (copied < bufferLen)
+        {
+            if (chunkOffset == chunk->length)
+            {
+                chunk       = chunk->next;
+                chunkOffset = 0;
+                continue;
+            }
+
+            const size_t copyLen = std::min(bufferLen - copied, static_cast<size_t>(chunk->length - chunkOffset));
+            memcpy(buffer->Start() + copied, chunk->Data() + chunkOffset, copyLen);
+            copied += copyLen;
+            chunkOffset += static_cast<uint32_t>(copyLen);
+        }
+        buffer->SetDataLength(bufferLen);
+        remaining -= bufferLen;
+
+        if (head.IsNull())
+        {
+            head = std::move(buffer);
+        }
+        else
+        {
+            head->AddToEnd(std::move(buffer));
+        }
+    } while (remaining > 0);
+
+    Reset();
+    outBuffer = std::move(head);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVArenaBackingStore::CopyTo(MutableByteSpan & outBuffer) const
+{
+    VerifyOrReturnError(DataLength() <= outBuffer.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    size_t offset = 0;
+    for (const Chunk * chunk = mHead; chunk != nullptr; chunk = chunk->next)
+    {
+        if (chunk->length > 0)
+        {
+            memcpy(outBuffer.data() + offset, chunk->Data(), chunk->length);
+            offset += chunk->length;
+        }
+    }
+    outBuffer.reduce_size(offset);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace System
+} // namespace chip
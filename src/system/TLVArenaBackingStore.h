@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file contains a growable, heap-backed implementation of TLVBackingStore
+ *      for encoding payloads whose size is not known up front.
+ */
+
+#pragma once
+
+#include <lib/core/TLV.h>
+#include <lib/support/Span.h>
+#include <system/SystemPacketBuffer.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * An implementation of TLVBackingStore that grows on demand.
+ *
+ * Data is written into a list of heap chunks, each twice the size of the previous one (up to
+ * kMaxChunkSize), so appending is amortized O(1) and already-written data is never copied while
+ * encoding.  Once encoding is done, the data can be moved into a PacketBuffer chain, or copied
+ * into a contiguous buffer, with a single copy.
+ *
+ * A TLVReader may also be initialized on the store to read back the encoded data in place.
+ */
+class TLVArenaBackingStore : public chip::TLV::TLVBackingStore
+{
+public:
+    static constexpr uint32_t kDefaultInitialChunkSize = 256;
+    static constexpr uint32_t kMaxChunkSize            = 16 * 1024;
+
+    TLVArenaBackingStore(uint32_t initialChunkSize = kDefaultInitialChunkSize) : mInitialChunkSize(initialChunkSize) {}
+    ~TLVArenaBackingStore() override { Reset(); }
+
+    TLVArenaBackingStore(const TLVArenaBackingStore &)             = delete;
+    TLVArenaBackingStore & operator=(const TLVArenaBackingStore &) = delete;
+
+    /**
+     * Total number of bytes written to the store by finalized writers.
+     */
+    size_t DataLength() const;
+
+    /**
+     * Move the written data into a newly allocated PacketBuffer chain and release the arena.
+     *
+     * Each buffer in the chain is filled up to PacketBuffer::kMaxSizeWithoutReserve, so a payload
+     * that fits in a single buffer yields an unchained buffer.
+     *
+     * @param[out] outBuffer     The PacketBuffer chain holding the data.
+     * @param[in]  reservedSize  Header space to reserve in the first buffer of the chain.
+     *
+     * @retval #CHIP_NO_ERROR          On success.
+     * @retval #CHIP_ERROR_NO_MEMORY   If the PacketBuffers could not be allocated.  The arena is left intact.
+     */
+    CHIP_ERROR MoveToPacketBuffers(PacketBufferHandle & outBuffer, uint16_t reservedSize = PacketBuffer::kDefaultHeaderReserve);
+
+    /**
+     * Copy the written data into @p outBuffer, reducing its size to the length of the data.
+     *
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL  If @p outBuffer cannot hold the data.
+     */
+    CHIP_ERROR CopyTo(MutableByteSpan & outBuffer) const;
+
+    /**
+     * Free all the memory held by the store.  Any TLVWriter or TLVReader using the store must be
+     * re-initialized before further use.
+     */
+    void Reset();
+
+    // TLVBackingStore overrides:
+    CHIP_ERROR OnInit(chip::TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR OnInit(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR GetNewBuffer(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
+    CHIP_ERROR FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
+
+private:
+    struct Chunk
+    {
+        Chunk * next;
+        uint32_t capacity;
+        uint32_t length;
+
+        uint8_t * Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+        const uint8_t * Data() const { return reinterpret_cast<const uint8_t *>(this + 1); }
+    };
+
+    CHIP_ERROR AppendChunk(uint8_t *& bufStart, uint32_t & bufLen);
+    void ReadChunk(const Chunk * chunk, const uint8_t *& bufStart, uint32_t & bufLen);
+
+    Chunk * mHead            = nullptr;
+    Chunk * mTail            = nullptr;
+    const Chunk * mReadChunk = nullptr;
+    uint32_t mInitialChunkSize;
+};
+
+/**
+ * A TLVWriter that encodes into a TLVArenaBackingStore, for payloads whose final size is not
+ * known ahead of time.
+ */
+class DLL_EXPORT ArenaTLVWriter : public chip::TLV::TLVWriter
+{
+public:
+    ArenaTLVWriter(uint32_t initialChunkSize = TLVArenaBackingStore::kDefaultInitialChunkSize) : mBackingStore(initialChunkSize) {}
+
+    /**
+     * Initializes the writer, discarding anything previously written.
+     *
+     * @param[in] maxLen  The maximum number of bytes that may be written.
+     */
+    CHIP_ERROR Init(uint32_t maxLen = UINT32_MAX) { return chip::TLV::TLVWriter::Init(mBackingStore, maxLen); }
+
+    using chip::TLV::TLVWriter::Finalize;
+
+    /**
+     * Finish the encoding and move it into a PacketBuffer chain.
+     *
+     * @note No further TLV operations may be performed, unless or until this ArenaTLVWriter is re-initialized.
+     */
+    CHIP_ERROR Finalize(PacketBufferHandle & outBuffer, uint16_t reservedSize = PacketBuffer::kDefaultHeaderReserve)
+    {
+        ReturnErrorOnFailure(chip::TLV::TLVWriter::Finalize());
+        return mBackingStore.MoveToPacketBuffers(outBuffer, reservedSize);
+    }
+
+    /**
+     * Finish the encoding and copy it into @p outBuffer, reducing its size to the length written.
+     */
+    CHIP_ERROR Finalize(MutableByteSpan & outBuffer)
+    {
+        ReturnErrorOnFailure(chip::TLV::TLVWriter::Finalize());
+        return mBackingStore.CopyTo(outBuffer);
+    }
+
+private:
+    TLVArenaBackingStore mBackingStore;
+};
+
+} // namespace System
+} // namespace chip
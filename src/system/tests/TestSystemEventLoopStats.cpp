@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/SystemConfig.h>
+#include <system/SystemEventLoopStats.h>
+#include <system/SystemLayer.h>
+
+using namespace chip::System;
+
+namespace {
+
+void CallbackA(Layer *, void *) {}
+void CallbackB(Layer *, void *) {}
+
+const void * CallbackAddress(TimerCompleteCallback callback)
+{
+    return reinterpret_cast<const void *>(callback);
+}
+
+size_t gLongTaskCount;
+Clock::Microseconds64 gLastLongTaskRunTime;
+
+void OnLongTask(const EventLoopStats::LongTask & task)
+{
+    gLongTaskCount++;
+    gLastLongTaskRunTime = task.runTime;
+}
+
+TEST(TestSystemEventLoopStats, TestHistogram)
+{
+    EventLoopStats::Histogram histogram;
+
+    histogram.Add(Clock::Microseconds64(0));
+    histogram.Add(Clock::Microseconds64(15));
+    histogram.Add(Clock::Microseconds64(16));
+    histogram.Add(Clock::Microseconds64(1500));
+    histogram.Add(Clock::Microseconds64(10'000'000));
+
+    EXPECT_EQ(histogram.GetCount(), 5u);
+    EXPECT_EQ(histogram.GetBucketCount(0), 2u);
+    EXPECT_EQ(histogram.GetBucketCount(1), 1u);
+    EXPECT_EQ(histogram.GetBucketCount(4), 1u); // [1024us, 4096us)
+    EXPECT_EQ(histogram.GetBucketCount(EventLoopStats::Histogram::kBucketCount - 1), 1u);
+    EXPECT_EQ(histogram.GetMax(), Clock::Microseconds64(10'000'000));
+    EXPECT_EQ(histogram.GetTotal(), Clock::Microseconds64(10'001'531));
+
+    EXPECT_EQ(EventLoopStats::Histogram::GetBucketLowerBound(0), Clock::kZero);
+    EXPECT_EQ(EventLoopStats::Histogram::GetBucketLowerBound(1), Clock::Microseconds64(16));
+    EXPECT_EQ(EventLoopStats::Histogram::GetBucketLowerBound(4), Clock::Microseconds64(1024));
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetBucketCount(0), 0u);
+}
+
+TEST(TestSystemEventLoopStats, TestCallbackScope)
+{
+    Clock::Internal::MockClock mockClock;
+    Clock::ClockBase * savedClock = &SystemClock();
+    Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    EventLoopStats stats;
+    stats.SetLongTaskThreshold(Clock::Milliseconds32(50));
+    stats.SetLongTaskHandler(OnLongTask);
+    gLongTaskCount = 0;
+
+    {
+        EventLoopStats::CallbackScope scope(stats, EventLoopStats::CallbackType::kTimer, CallbackAddress(CallbackA));
+        mockClock.AdvanceMonotonic(Clock::Milliseconds64(2));
+    }
+    {
+        EventLoopStats::CallbackScope scope(stats, EventLoopStats::CallbackType::kTimer, CallbackAddress(CallbackB));
+        mockClock.AdvanceMonotonic(Clock::Milliseconds64(60));
+    }
+    {
+        EventLoopStats::CallbackScope scope(stats, EventLoopStats::CallbackType::kTimer, CallbackAddress(CallbackA));
+        mockClock.AdvanceMonotonic(Clock::Milliseconds64(4));
+    }
+
+    // Run times are accounted per callback, and only the long one is reported
+    auto callbacks = stats.GetCallbacks();
+    ASSERT_EQ(callbacks.size(), 2u);
+    EXPECT_EQ(callbacks[0].callback, CallbackAddress(CallbackA));
+    EXPECT_EQ(callbacks[0].runTime.GetCount(), 2u);
+    EXPECT_EQ(callbacks[0].runTime.GetTotal(), Clock::Microseconds64(6000));
+    EXPECT_EQ(callbacks[0].runTime.GetMax(), Clock::Microseconds64(4000));
+    EXPECT_EQ(callbacks[1].callback, CallbackAddress(CallbackB));
+    EXPECT_EQ(callbacks[1].runTime.GetCount(), 1u);
+    EXPECT_EQ(gLongTaskCount, 1u);
+    EXPECT_EQ(gLastLongTaskRunTime, Clock::Microseconds64(60000));
+
+    // Nothing is measured while disabled
+    stats.SetEnabled(false);
+    {
+        EventLoopStats::CallbackScope scope(stats, EventLoopStats::CallbackType::kSocket, CallbackAddress(CallbackA));
+        mockClock.AdvanceMonotonic(Clock::Milliseconds64(100));
+    }
+    stats.RecordQueueWait(Clock::Microseconds64(100));
+    EXPECT_EQ(stats.GetCallbacks().size(), 2u);
+    EXPECT_EQ(stats.GetQueueWaitTime().GetCount(), 0u);
+    EXPECT_EQ(gLongTaskCount, 1u);
+
+    stats.SetEnabled(true);
+    stats.RecordQueueWait(Clock::Microseconds64(100));
+    EXPECT_EQ(stats.GetQueueWaitTime().GetCount(), 1u);
+
+    stats.Reset();
+    EXPECT_EQ(stats.GetCallbacks().size(), 0u);
+    EXPECT_EQ(stats.GetQueueWaitTime().GetCount(), 0u);
+
+    Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+TEST(TestSystemEventLoopStats, TestTooManyCallbacks)
+{
+    EventLoopStats stats;
+
+    // Use distinct (never called) addresses as callbacks
+    static uint8_t callbacks[CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS + 2];
+    for (auto & callback : callbacks)
+    {
+        stats.RecordRunTime(EventLoopStats::CallbackType::kSocket, &callback, Clock::Microseconds64(10));
+    }
+    stats.RecordRunTime(EventLoopStats::CallbackType::kSocket, &callbacks[0], Clock::Microseconds64(10));
+
+    // The callbacks that do not fit are accounted together in the last entry
+    auto entries = stats.GetCallbacks();
+    ASSERT_EQ(entries.size(), static_cast<size_t>(CHIP_SYSTEM_CONFIG_EVENT_LOOP_STATS_CALLBACKS + 1));
+    EXPECT_EQ(entries[0].callback, &callbacks[0]);
+    EXPECT_EQ(entries[0].runTime.GetCount(), 2u);
+    EXPECT_EQ(entries[entries.size() - 1].callback, nullptr);
+    EXPECT_EQ(entries[entries.size() - 1].runTime.GetCount(), 2u);
+}
+
+} // namespace
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <system/TLVArenaBackingStore.h>
+#include <system/TLVPacketBufferBackingStore.h>
+
+using ::chip::System::ArenaTLVWriter;
+using ::chip::System::PacketBuffer;
+using ::chip::System::PacketBufferHandle;
+using ::chip::System::TLVArenaBackingStore;
+using namespace ::chip;
+
+namespace {
+
+class TestTLVArenaBackingStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Writes an array of `count` byte strings of `stringLen` bytes, where string i is filled with the value i.
+void WriteStrings(TLV::TLVWriter & writer, uint8_t count, size_t stringLen)
+{
+    uint8_t data[200];
+    ASSERT_LE(stringLen, sizeof(data));
+
+    TLV::TLVType outerContainerType;
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerContainerType), CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        memset(data, i, stringLen);
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), ByteSpan(data, stringLen)), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(outerContainerType), CHIP_NO_ERROR);
+}
+
+void CheckStrings(TLV::TLVReader & reader, uint8_t count, size_t stringLen)
+{
+    uint8_t data[200];
+    TLV::TLVType outerContainerType;
+
+    ASSERT_EQ(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.EnterContainer(outerContainerType), CHIP_NO_ERROR);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        ASSERT_EQ(reader.Next(TLV::kTLVType_ByteString, TLV::AnonymousTag()), CHIP_NO_ERROR);
+        ASSERT_EQ(reader.GetLength(), stringLen);
+        ASSERT_EQ(reader.GetBytes(data, sizeof(data)), CHIP_NO_ERROR);
+        for (size_t j = 0; j < stringLen; j++)
+        {
+            ASSERT_EQ(data[j], i);
+        }
+    }
+    ASSERT_EQ(reader.ExitContainer(outerContainerType), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+}
+
+} // namespace
+
+TEST_F(TestTLVArenaBackingStore, SmallPayloadIsSingleBuffer)
+{
+    ArenaTLVWriter writer;
+    ASSERT_EQ(writer.Init(), CHIP_NO_ERROR);
+
+    WriteStrings(writer, 3, 10);
+    const uint32_t lengthWritten = writer.GetLengthWritten();
+
+    PacketBufferHandle buffer;
+    ASSERT_EQ(writer.Finalize(buffer), CHIP_NO_ERROR);
+    ASSERT_FALSE(buffer.IsNull());
+    EXPECT_FALSE(buffer->HasChainedBuffer());
+    EXPECT_EQ(buffer->DataLength(), lengthWritten);
+    EXPECT_GE(buffer->ReservedSize(), PacketBuffer::kDefaultHeaderReserve);
+
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(buffer));
+    CheckStrings(reader, 3, 10);
+}
+
+TEST_F(TestTLVArenaBackingStore, LargePayloadSpansChunksAndBuffers)
+{
+    // Start with a tiny chunk so that the encoding spans many chunks.
+    ArenaTLVWriter writer(16);
+    ASSERT_EQ(writer.Init(), CHIP_NO_ERROR);
+
+    // About 20kB, larger than any single PacketBuffer.
+    WriteStrings(writer, 100, 200);
+    const uint32_t lengthWritten = writer.GetLengthWritten();
+
+    PacketBufferHandle buffer;
+    ASSERT_EQ(writer.Finalize(buffer, 0), CHIP_NO_ERROR);
+    ASSERT_FALSE(buffer.IsNull());
+    EXPECT_TRUE(buffer->HasChainedBuffer());
+    EXPECT_EQ(buffer->TotalLength(), lengthWritten);
+
+    System::TLVPacketBufferBackingStore store(std::move(buffer), true);
+    TLV::TLVReader reader;
+    ASSERT_EQ(reader.Init(store), CHIP_NO_ERROR);
+    CheckStrings(reader, 100, 200);
+}
+
+TEST_F(TestTLVArenaBackingStore, ReadBackInPlace)
+{
+    TLVArenaBackingStore store(32);
+    TLV::TLVWriter writer;
+    ASSERT_EQ(writer.Init(store), CHIP_NO_ERROR);
+
+    WriteStrings(writer, 20, 50);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(store.DataLength(), writer.GetLengthWritten());
+
+    TLV::TLVReader reader;
+    ASSERT_EQ(reader.Init(store), CHIP_NO_ERROR);
+    CheckStrings(reader, 20, 50);
+}
+
+TEST_F(TestTLVArenaBackingStore, CopyToContiguousBuffer)
+{
+    ArenaTLVWriter writer(8);
+    ASSERT_EQ(writer.Init(), CHIP_NO_ERROR);
+    WriteStrings(writer, 10, 30);
+    const uint32_t lengthWritten = writer.GetLengthWritten();
+
+    uint8_t small[100];
+    MutableByteSpan smallSpan(small);
+    EXPECT_EQ(writer.Finalize(smallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    ASSERT_EQ(writer.Init(), CHIP_NO_ERROR);
+    WriteStrings(writer, 10, 30);
+
+    uint8_t large[1024];
+    MutableByteSpan largeSpan(large);
+    ASSERT_EQ(writer.Finalize(largeSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(largeSpan.size(), lengthWritten);
+
+    TLV::TLVReader reader;
+    reader.Init(largeSpan);
+    CheckStrings(reader, 10, 30);
+}
+
+TEST_F(TestTLVArenaBackingStore, MaxLengthIsEnforced)
+{
+    ArenaTLVWriter writer;
+    ASSERT_EQ(writer.Init(64), CHIP_NO_ERROR);
+
+    uint8_t data[100] = {};
+    EXPECT_EQ(writer.Put(TLV::AnonymousTag(), ByteSpan(data)), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
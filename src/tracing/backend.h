@@ -19,6 +19,8 @@
 #include <lib/support/IntrusiveList.h>
 #include <tracing/log_declares.h>
 
+#include <stdint.h>
+
 namespace chip {
 namespace Tracing {
 
@@ -64,6 +66,10 @@ public:
     virtual void TraceInstant(const char * label, const char * group) {}
 
     virtual void TraceCounter(const char * label) {}
+
+    /// Trace the current value of a quantity that can go up and down (e.g. pool usage)
+    virtual void TraceCounterValue(const char * label, int64_t value) {}
+
     virtual void LogMessageSend(MessageSendInfo &) { TraceInstant("MessageSent", "Messaging"); }
     virtual void LogMessageReceived(MessageReceivedInfo &) { TraceInstant("MessageReceived", "Messaging"); }
 
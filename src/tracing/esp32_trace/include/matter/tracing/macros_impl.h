@@ -29,6 +29,7 @@
 #define MATTER_TRACE_END(label, group) ::chip::Tracing::Internal::End(label, group)
 #define MATTER_TRACE_INSTANT(label, group) ::chip::Tracing::Internal::Instant(label, group)
 #define MATTER_TRACE_COUNTER(label) ::chip::Tracing::Internal::Counter(label)
+#define MATTER_TRACE_COUNTER_VALUE(label, value) ::chip::Tracing::Internal::CounterValue(label, static_cast<int64_t>(value))
 
 namespace chip {
 namespace Tracing {
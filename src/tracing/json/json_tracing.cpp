@@ -297,6 +297,16 @@ void JsonBackend::TraceCounter(const char * label)
     OutputValue(value);
 }
 
+void JsonBackend::TraceCounterValue(const char * label, int64_t counterValue)
+{
+    ::Json::Value value;
+    value["event"] = "TraceCounterValue";
+    value["label"] = label;
+    value["value"] = static_cast<::Json::Int64>(counterValue);
+
+    OutputValue(value);
+}
+
 void JsonBackend::LogMetricEvent(const MetricEvent & event)
 {
     ::Json::Value value;
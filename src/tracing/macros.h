@@ -30,6 +30,10 @@
 // Tracing macro to trace monotonically increasing counter values.
 //  MATTER_TRACE_COUNTER(label)
 
+// Tracing macro to trace the current value of a quantity that can go up and
+// down (e.g. objects in use in a pool). `label` MUST be a string literal.
+//  MATTER_TRACE_COUNTER_VALUE(label, value)
+
 #include <matter/tracing/macros_impl.h>
 #include <tracing/log_declares.h>
 #include <tracing/registry.h>
@@ -83,6 +87,7 @@
 #define MATTER_TRACE_INSTANT(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 #define MATTER_TRACE_SCOPE(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 #define MATTER_TRACE_COUNTER(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
+#define MATTER_TRACE_COUNTER_VALUE(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 
 #define MATTER_LOG_MESSAGE_SEND(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
 #define MATTER_LOG_MESSAGE_RECEIVED(...) _MATTER_TRACE_DISABLE(__VA_ARGS__)
@@ -78,5 +78,8 @@ constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Event loop callback that ran for longer than the long task threshold, value is its run time in ms
+constexpr MetricKey kMetricEventLoopLongTask = "core_event_loop_long_task";
+
 } // namespace Tracing
 } // namespace chip
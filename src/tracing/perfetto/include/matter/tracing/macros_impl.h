@@ -37,3 +37,5 @@ PERFETTO_DEFINE_CATEGORIES(perfetto::Category("Matter").SetDescription("Matter t
         static int count##_label = 0;                                                                                              \
         TRACE_COUNTER("Matter", label, ++count##_label);                                                                           \
     } while (0)
+
+#define MATTER_TRACE_COUNTER_VALUE(label, value) TRACE_COUNTER("Matter", label, static_cast<int64_t>(value))
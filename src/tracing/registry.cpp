@@ -84,6 +84,14 @@ void Counter(const char * label)
     }
 }
 
+void CounterValue(const char * label, int64_t value)
+{
+    for (auto & backend : gTracingBackends)
+    {
+        backend.TraceCounterValue(label, value);
+    }
+}
+
 void LogMessageSend(::chip::Tracing::MessageSendInfo & info)
 {
     for (auto & backend : gTracingBackends)
@@ -77,6 +77,7 @@ void Begin(const char * label, const char * group);
 void End(const char * label, const char * group);
 void Instant(const char * label, const char * group);
 void Counter(const char * label);
+void CounterValue(const char * label, int64_t value);
 
 void LogMessageSend(::chip::Tracing::MessageSendInfo & info);
 void LogMessageReceived(::chip::Tracing::MessageReceivedInfo & info);
@@ -50,6 +50,11 @@ public:
         mTraces.push_back(std::string("INSTANT:") + group + ":" + label);
     }
 
+    void TraceCounterValue(const char * label, int64_t value) override
+    {
+        mTraces.push_back(std::string("COUNTER:") + label + ":" + std::to_string(value));
+    }
+
 private:
     std::vector<std::string> mTraces;
 };
@@ -133,4 +138,27 @@ TEST(TestTracing, TestMultipleBackends)
     EXPECT_TRUE(std::equal(b3.traces().begin(), b3.traces().end(), expected3.begin(), expected3.end()));
 }
 
+TEST(TestTracing, TestCounterValues)
+{
+    LoggingTraceBackend backend;
+
+    {
+        ScopedRegistration scope(backend);
+
+        MATTER_TRACE_COUNTER_VALUE("Pool", 3);
+        MATTER_TRACE_COUNTER_VALUE("Pool", 2u);
+        MATTER_TRACE_COUNTER_VALUE("Bytes", static_cast<size_t>(1024));
+    }
+    MATTER_TRACE_COUNTER_VALUE("Pool", 1);
+
+    std::vector<std::string> expected = {
+        "COUNTER:Pool:3",
+        "COUNTER:Pool:2",
+        "COUNTER:Bytes:1024",
+    };
+
+    EXPECT_EQ(backend.traces().size(), expected.size());
+    EXPECT_TRUE(std::equal(backend.traces().begin(), backend.traces().end(), expected.begin(), expected.end()));
+}
+
 } // namespace
@@ -28,6 +28,33 @@
 namespace chip {
 namespace Transport {
 
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+namespace {
+
+uint32_t PeerKey(NodeId nodeId)
+{
+    return static_cast<uint32_t>(nodeId ^ (nodeId >> 32));
+}
+
+template <size_t N>
+CHIP_ERROR FindOrAddIndexedPeer(HashIndex<GroupSender, N> & index, GroupSender (&senders)[N], uint8_t & peerCount, NodeId nodeId,
+                                GroupSender *& sender)
+{
+    sender = index.Find(PeerKey(nodeId), [nodeId](GroupSender * peer) { return peer->mNodeId == nodeId; });
+    if (sender == nullptr)
+    {
+        // Peers are kept compact, so a new peer goes right after the known ones.
+        VerifyOrReturnError(peerCount < N, CHIP_ERROR_TOO_MANY_PEER_NODES);
+        sender          = &senders[peerCount++];
+        sender->mNodeId = nodeId;
+        index.Add(PeerKey(nodeId), sender);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+
 CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                                          chip::Transport::PeerMessageCounter *& counter)
 {
@@ -36,6 +63,34 @@ CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId,
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
+    {
+        GroupFabric & groupFabric = mGroupFabrics[it];
+        if (groupFabric.mFabricIndex == kUndefinedFabricIndex)
+        {
+            // Already iterated through all known fabricIndex, the peer is added to a new one below
+            groupFabric.mFabricIndex = fabricIndex;
+        }
+
+        if (fabricIndex == groupFabric.mFabricIndex)
+        {
+            GroupSender * sender = nullptr;
+            if (isControl)
+            {
+                ReturnErrorOnFailure(FindOrAddIndexedPeer(mControlPeerIndexes[it], groupFabric.mControlGroupSenders,
+                                                          groupFabric.mControlPeerCount, nodeId, sender));
+            }
+            else
+            {
+                ReturnErrorOnFailure(FindOrAddIndexedPeer(mDataPeerIndexes[it], groupFabric.mDataGroupSenders,
+                                                          groupFabric.mDataPeerCount, nodeId, sender));
+            }
+            counter = &(sender->msgCounter);
+            return CHIP_NO_ERROR;
+        }
+    }
+#else
     for (auto & groupFabric : mGroupFabrics)
     {
         if (groupFabric.mFabricIndex == kUndefinedFabricIndex)
@@ -106,6 +161,7 @@ CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId,
             return CHIP_ERROR_TOO_MANY_PEER_NODES;
         }
     }
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
 
     // Exceeded the Max number of Group peers
     return CHIP_ERROR_TOO_MANY_PEER_NODES;
@@ -151,6 +207,9 @@ CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bo
     // Remove Fabric entry from PeerTable if empty
     if (fabricIt < CHIP_CONFIG_MAX_FABRICS)
     {
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+        ReindexFabric(fabricIt);
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
         if (mGroupFabrics[fabricIt].mDataPeerCount == 0 && mGroupFabrics[fabricIt].mControlPeerCount == 0)
         {
             RemoveAndCompactFabric(fabricIt);
@@ -252,10 +311,38 @@ void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
             // move it up front
             new (&mGroupFabrics[tableIndex]) GroupFabric(mGroupFabrics[i]);
             new (&mGroupFabrics[i]) GroupFabric();
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+            ReindexFabric(i);
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
             break;
         }
     }
+
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+    ReindexFabric(tableIndex);
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+}
+
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+void GroupPeerTable::ReindexFabric(uint32_t tableIndex)
+{
+    GroupFabric & groupFabric = mGroupFabrics[tableIndex];
+
+    mDataPeerIndexes[tableIndex].Clear();
+    for (uint8_t i = 0; i < groupFabric.mDataPeerCount; i++)
+    {
+        GroupSender & sender = groupFabric.mDataGroupSenders[i];
+        mDataPeerIndexes[tableIndex].Add(PeerKey(sender.mNodeId), &sender);
+    }
+
+    mControlPeerIndexes[tableIndex].Clear();
+    for (uint8_t i = 0; i < groupFabric.mControlPeerCount; i++)
+    {
+        GroupSender & sender = groupFabric.mControlGroupSenders[i];
+        mControlPeerIndexes[tableIndex].Add(PeerKey(sender.mNodeId), &sender);
+    }
 }
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
 
 GroupOutgoingCounters::GroupOutgoingCounters(chip::PersistentStorageDelegate * storage_delegate)
 {
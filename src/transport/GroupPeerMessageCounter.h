@@ -29,6 +29,9 @@
 #include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/Span.h>
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+#include <lib/support/HashIndex.h>
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
 #include <transport/PeerMessageCounter.h>
 
 #define GROUP_MSG_COUNTER_MIN_INCREMENT 1000
@@ -71,6 +74,15 @@ protected:
     void RemoveAndCompactFabric(uint32_t tableIndex);
 
     GroupFabric mGroupFabrics[CHIP_CONFIG_MAX_FABRICS];
+
+#if CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
+private:
+    // Indexes have to be rebuilt whenever peers are moved around by compaction.
+    void ReindexFabric(uint32_t tableIndex);
+
+    HashIndex<GroupSender, CHIP_CONFIG_MAX_GROUP_DATA_PEERS> mDataPeerIndexes[CHIP_CONFIG_MAX_FABRICS];
+    HashIndex<GroupSender, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS> mControlPeerIndexes[CHIP_CONFIG_MAX_FABRICS];
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_INDEX
 };
 
 // Might want to rename this so that it is explicitly the sending side of counters
@@ -0,0 +1,104 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines an estimator of the round-trip time to a peer, fed with the ack timing of reliable messages.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Smoothed round-trip time (SRTT) and round-trip time variation (RTTVAR) estimator, as specified by RFC 6298.
+ *
+ * Callers are responsible for following Karn's rule: the time it took to acknowledge a message that was
+ * retransmitted is ambiguous, and must not be given to AddSample().
+ */
+class RoundTripTimeEstimator
+{
+public:
+    void AddSample(System::Clock::Milliseconds32 sample)
+    {
+        // SRTT is kept scaled by 8 and RTTVAR by 4, so that the 1/8 and 1/4 gains are exact in integer arithmetic.
+        const int64_t rtt = sample.count();
+        if (mSampleCount == 0)
+        {
+            mScaledSmoothedRtt  = rtt << 3;
+            mScaledRttVariation = rtt << 1;
+            mMinRtt             = sample;
+        }
+        else
+        {
+            const int64_t error = rtt - (mScaledSmoothedRtt >> 3);
+            mScaledSmoothedRtt += error;
+            mScaledRttVariation += (error < 0 ? -error : error) - (mScaledRttVariation >> 2);
+            if (sample < mMinRtt)
+            {
+                mMinRtt = sample;
+            }
+        }
+
+        if (mSampleCount < UINT32_MAX)
+        {
+            mSampleCount++;
+        }
+    }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+    uint32_t GetSampleCount() const { return mSampleCount; }
+
+    System::Clock::Milliseconds32 GetSmoothedRtt() const
+    {
+        return System::Clock::Milliseconds32(static_cast<uint32_t>(mScaledSmoothedRtt >> 3));
+    }
+
+    System::Clock::Milliseconds32 GetRttVariation() const
+    {
+        return System::Clock::Milliseconds32(static_cast<uint32_t>(mScaledRttVariation >> 2));
+    }
+
+    /**
+     * The smallest sample seen so far: an acknowledgment arriving sooner than that after a message was sent
+     * is unlikely to be for that very transmission.
+     */
+    System::Clock::Milliseconds32 GetMinRtt() const { return mMinRtt; }
+
+    /**
+     * The retransmission timeout, SRTT + 4 * RTTVAR.  Only meaningful if HasEstimate().
+     */
+    System::Clock::Milliseconds32 GetRetransTimeout() const
+    {
+        return System::Clock::Milliseconds32(static_cast<uint32_t>((mScaledSmoothedRtt >> 3) + mScaledRttVariation));
+    }
+
+    void Reset() { *this = RoundTripTimeEstimator(); }
+
+private:
+    int64_t mScaledSmoothedRtt  = 0;
+    int64_t mScaledRttVariation = 0;
+    System::Clock::Milliseconds32 mMinRtt{ 0 };
+    uint32_t mSampleCount = 0;
+};
+
+} // namespace Transport
+} // namespace chip
@@ -27,6 +27,7 @@
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
+#include <tracing/macros.h>
 #include <transport/SecureMessageCodec.h>
 
 namespace chip {
@@ -39,6 +40,8 @@ namespace SecureMessageCodec {
 CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
                    PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf)
 {
+    MATTER_TRACE_SCOPE("Encrypt", "SecureMessageCodec");
+
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
@@ -61,6 +64,8 @@ CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView
 CHIP_ERROR Decrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
                    const PacketHeader & packetHeader, System::PacketBufferHandle & msg)
 {
+    MATTER_TRACE_SCOPE("Decrypt", "SecureMessageCodec");
+
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
 
     uint8_t * data = msg->Start();
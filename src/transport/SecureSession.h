@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/RoundTripTimeEstimator.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/PeerAddress.h>
@@ -274,6 +275,10 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+    // Round-trip time to the peer, as measured by the ReliableMessageMgr from the acknowledgments of our messages.
+    RoundTripTimeEstimator & GetRoundTripTimeEstimator() { return mRoundTripTimeEstimator; }
+    const RoundTripTimeEstimator & GetRoundTripTimeEstimator() const { return mRoundTripTimeEstimator; }
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -353,6 +358,7 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    RoundTripTimeEstimator mRoundTripTimeEstimator;
 };
 
 } // namespace Transport
@@ -41,6 +41,7 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemStats.h>
 #include <tracing/macros.h>
 #include <transport/GroupPeerMessageCounter.h>
 #include <transport/GroupSession.h>
@@ -96,6 +97,14 @@ void CorrectPeerAddressInterfaceID(Transport::PeerAddress & peerAddress)
     peerAddress.SetInterface(Inet::InterfaceId::Null());
 }
 
+// Packet buffers are allocated below the tracing layer, so their usage is sampled as messages go through
+void TracePacketBufferUsage()
+{
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    MATTER_TRACE_COUNTER_VALUE("PacketBuffersInUse", System::Stats::GetResourcesInUse()[System::Stats::kSystemLayer_NumPacketBufs]);
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+}
+
 } // namespace
 
 uint32_t EncryptedPacketBufferHandle::GetMessageCounter() const
@@ -198,6 +207,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
                                           System::PacketBufferHandle && message, EncryptedPacketBufferHandle & preparedMessage)
 {
     MATTER_TRACE_SCOPE("PrepareMessage", "SessionManager");
+    TracePacketBufferUsage();
 
     PacketHeader packetHeader;
     bool isControlMsg = IsControlMessage(payloadHeader);
@@ -656,29 +666,33 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        Transport::MessageTransportContext * ctxt)
 {
-    PacketHeader partialPacketHeader;
+    TracePacketBufferUsage();
+
+    // Only the fixed portion can be decoded for now: the rest may be obfuscated by group privacy.  Unicast
+    // messages complete this same header rather than decoding it again.
+    PacketHeader packetHeader;
 
-    CHIP_ERROR err = partialPacketHeader.DecodeFixed(msg);
+    CHIP_ERROR err = packetHeader.DecodeFixed(msg);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Failed to decode packet header: %" CHIP_ERROR_FORMAT, err.Format());
         return;
     }
 
-    if (partialPacketHeader.IsEncrypted())
+    if (packetHeader.IsEncrypted())
     {
-        if (partialPacketHeader.IsGroupSession())
+        if (packetHeader.IsGroupSession())
         {
-            SecureGroupMessageDispatch(partialPacketHeader, peerAddress, std::move(msg));
+            SecureGroupMessageDispatch(packetHeader, peerAddress, std::move(msg));
         }
         else
         {
-            SecureUnicastMessageDispatch(partialPacketHeader, peerAddress, std::move(msg), ctxt);
+            SecureUnicastMessageDispatch(packetHeader, peerAddress, std::move(msg), ctxt);
         }
     }
     else
     {
-        UnauthenticatedMessageDispatch(partialPacketHeader, peerAddress, std::move(msg), ctxt);
+        UnauthenticatedMessageDispatch(packetHeader, peerAddress, std::move(msg), ctxt);
     }
 }
 
@@ -786,9 +800,8 @@ void SessionManager::TCPDisconnect(Transport::ActiveTCPConnectionState * conn, b
 }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partialPacketHeader,
-                                                    const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
-                                                    Transport::MessageTransportContext * ctxt)
+void SessionManager::UnauthenticatedMessageDispatch(PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+                                                    System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt)
 {
     MATTER_TRACE_SCOPE("Unauthenticated Message Dispatch", "SessionManager");
 
@@ -801,14 +814,13 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
     // Drop unsecured messages with privacy enabled.
-    if (partialPacketHeader.HasPrivacyFlag())
+    if (packetHeader.HasPrivacyFlag())
     {
         ChipLogError(Inet, "Dropping unauthenticated message with privacy flag set");
         return;
     }
 
-    PacketHeader packetHeader;
-    ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
+    ReturnOnFailure(packetHeader.DecodeRemainingAndConsume(msg));
 
     Optional<NodeId> source      = packetHeader.GetSourceNodeId();
     Optional<NodeId> destination = packetHeader.GetDestinationNodeId();
@@ -906,9 +918,8 @@ void SessionManager::UnauthenticatedMessageDispatch(const PacketHeader & partial
     }
 }
 
-void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader,
-                                                  const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
-                                                  Transport::MessageTransportContext * ctxt)
+void SessionManager::SecureUnicastMessageDispatch(PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+                                                  System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt)
 {
     MATTER_TRACE_SCOPE("Secure Unicast Message Dispatch", "SessionManager");
 
@@ -922,10 +933,10 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    Optional<SessionHandle> session = mSecureSessions.FindSecureSessionByLocalKey(partialPacketHeader.GetSessionId());
+    Optional<SessionHandle> session = mSecureSessions.FindSecureSessionByLocalKey(packetHeader.GetSessionId());
     if (!session.HasValue())
     {
-        ChipLogError(Inet, "Data received on an unknown session (LSID=%d). Dropping it!", partialPacketHeader.GetSessionId());
+        ChipLogError(Inet, "Data received on an unknown session (LSID=%d). Dropping it!", packetHeader.GetSessionId());
         return;
     }
 
@@ -960,14 +971,13 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     PayloadHeader payloadHeader;
 
     // Drop secure unicast messages with privacy enabled.
-    if (partialPacketHeader.HasPrivacyFlag())
+    if (packetHeader.HasPrivacyFlag())
     {
         ChipLogError(Inet, "Dropping secure unicast message with privacy flag set");
         return;
     }
 
-    PacketHeader packetHeader;
-    ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
+    ReturnOnFailure(packetHeader.DecodeRemainingAndConsume(msg));
 
     SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
 
@@ -1110,6 +1120,45 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
     return decrypted;
 }
 
+/**
+ * Helper function to implement a single attempt to decrypt a groupcast message without privacy, whose packet
+ * header was decoded once for all attempts.
+ *
+ * @param[in] packetHeader The fully decoded packet header.
+ * @param[in] headerSize The size of the encoded packet header.
+ * @param[out] payloadHeader The payload header of the decrypted message
+ * @param[in] msg The message, including its packet header
+ * @param[out] msgCopy A copy of the message, to be filled with the decrypted message
+ * @param[in] groupContext The group context to use for decryption key material
+ *
+ * @return true if the message was decrypted successfully
+ * @return false if the message could not be decrypted
+ */
+static bool GroupKeyDecryptAttempt(const PacketHeader & packetHeader, uint16_t headerSize, PayloadHeader & payloadHeader,
+                                   const System::PacketBufferHandle & msg, System::PacketBufferHandle & msgCopy,
+                                   const Credentials::GroupDataProvider::GroupSession & groupContext)
+{
+    // Checking the group first avoids copying the message for the keys of every other group sharing the session id.
+    if (packetHeader.GetDestinationGroupId().Value() != groupContext.group_id)
+    {
+        return false;
+    }
+
+    msgCopy = msg.CloneData();
+    if (msgCopy.IsNull())
+    {
+        ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
+        return false;
+    }
+    msgCopy->ConsumeHead(headerSize);
+
+    CryptoContext context(groupContext.keyContext);
+    CryptoContext::NonceStorage nonce;
+    CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
+                              packetHeader.GetSourceNodeId().Value());
+    return CHIP_NO_ERROR == SecureMessageCodec::Decrypt(context, nonce, payloadHeader, packetHeader, msgCopy);
+}
+
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPacketHeader,
                                                 const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg)
 {
@@ -1157,10 +1206,27 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     ReturnOnFailure(mac.Decode(partialPacketHeader, &data[len - footerLen], footerLen, &taglen));
     VerifyOrReturn(taglen == footerLen);
 
+    // Without privacy, the rest of the packet header is in the clear, and the same for every key: decode it once.
+    const bool privacy       = partialPacketHeader.HasPrivacyFlag();
+    uint16_t clearHeaderSize = 0;
+    if (!privacy)
+    {
+        if (packetHeaderCopy.Decode(data, len, &clearHeaderSize) != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
+            return;
+        }
+    }
+
     bool decrypted = false;
     while (!decrypted && iter->Next(groupContext))
     {
-        CryptoContext context(groupContext.keyContext);
+        if (!privacy)
+        {
+            decrypted = GroupKeyDecryptAttempt(packetHeaderCopy, clearHeaderSize, payloadHeader, msg, msgCopy, groupContext);
+            continue;
+        }
+
         msgCopy = msg.CloneData();
         if (msgCopy.IsNull())
         {
@@ -1168,12 +1234,11 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
             return;
         }
 
-        bool privacy = partialPacketHeader.HasPrivacyFlag();
         decrypted =
             GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
 
 #if CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
-        if (privacy && !decrypted)
+        if (!decrypted)
         {
             // Try processing the P=1 message again without privacy as a work-around for invalid early-SVE2 nodes.
             msgCopy = msg.CloneData();
@@ -582,14 +582,14 @@ private:
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
-     * @param[in] partialPacketHeader The partial PacketHeader of the message after processing with DecodeFixed.
-     * If the message decrypts successfully, this will be filled with a fully decoded PacketHeader.
+     * @param[in,out] packetHeader The partial PacketHeader of the message after processing with DecodeFixed.
+     * The rest of the header is decoded into it, so that the fixed portion does not get decoded twice.
      * @param[in] peerAddress The PeerAddress of the message as provided by the receiving Transport Endpoint.
      * @param msg The full message buffer, including header fields.
      * @param ctxt The pointer to additional context on the underlying transport. For TCP, it is a pointer
      *             to the underlying connection object.
      */
-    void SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
+    void SecureUnicastMessageDispatch(PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                       System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
     /**
@@ -605,13 +605,14 @@ private:
     /**
      * @brief Parse, decrypt, validate, and dispatch an unsecured message.
      *
-     * @param partialPacketHeader The partial PacketHeader of the message after processing with DecodeFixed.
+     * @param[in,out] packetHeader The partial PacketHeader of the message after processing with DecodeFixed.
+     * The rest of the header is decoded into it.
      * @param peerAddress The PeerAddress of the message as provided by the receiving Transport Endpoint.
      * @param msg The full message buffer, including header fields.
      * @param ctxt The pointer to additional context on the underlying transport. For TCP, it is a pointer
      *             to the underlying connection object.
      */
-    void UnauthenticatedMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
+    void UnauthenticatedMessageDispatch(PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                         System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
     void OnReceiveError(CHIP_ERROR error, const Transport::PeerAddress & source);
@@ -65,6 +65,9 @@ using namespace chip::Encoding;
 /// size of the fixed portion of the header
 constexpr size_t kFixedUnencryptedHeaderSizeBytes = 8;
 
+/// size of the fields decoded by PacketHeader::DecodeFixed: message flags, session id and security flags
+constexpr size_t kFixedFieldsSizeBytes = 4;
+
 /// size of the encrypted portion of the header
 constexpr size_t kEncryptedHeaderSizeBytes = 6;
 
@@ -163,12 +166,19 @@ CHIP_ERROR PacketHeader::DecodeFixed(const System::PacketBufferHandle & buf)
 
 CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
     LittleEndian::Reader reader(data, size);
+
+    ReturnErrorOnFailure(DecodeFixedCommon(reader));
+    ReturnErrorOnFailure(DecodeVariable(reader));
+
     // TODO: De-uint16-ify everything related to this library
-    uint16_t octets_read;
+    *decode_len = static_cast<uint16_t>(reader.OctetsRead());
+    return CHIP_NO_ERROR;
+}
 
-    SuccessOrExit(err = DecodeFixedCommon(reader));
+CHIP_ERROR PacketHeader::DecodeVariable(Encoding::LittleEndian::Reader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
 
     SuccessOrExit(err = reader.Read32(&mMessageCounter).StatusCode());
 
@@ -231,9 +241,6 @@ CHIP_ERROR PacketHeader::Decode(const uint8_t * const data, size_t size, uint16_
         reader.Skip(mxLength);
     }
 
-    octets_read = static_cast<uint16_t>(reader.OctetsRead());
-    *decode_len = octets_read;
-
 exit:
 
     return err;
@@ -247,6 +254,15 @@ CHIP_ERROR PacketHeader::DecodeAndConsume(const System::PacketBufferHandle & buf
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR PacketHeader::DecodeRemainingAndConsume(const System::PacketBufferHandle & buf)
+{
+    LittleEndian::Reader reader(buf->Start(), buf->DataLength());
+    reader.Skip(kFixedFieldsSizeBytes);
+    ReturnErrorOnFailure(DecodeVariable(reader));
+    buf->ConsumeHead(reader.OctetsRead());
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR PayloadHeader::Decode(const uint8_t * const data, size_t size, uint16_t * decode_len)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -445,6 +445,18 @@ public:
      */
     CHIP_ERROR DecodeAndConsume(const System::PacketBufferHandle & buf);
 
+    /**
+     * Completes the decoding of a header whose fixed portion was decoded from
+     * the same buffer by DecodeFixed, without decoding that portion again, and
+     * consumes the bytes of the whole header.
+     *
+     * @return CHIP_NO_ERROR on success.
+     *
+     * Possible failures:
+     *    CHIP_ERROR_INVALID_ARGUMENT on insufficient buffer size
+     */
+    CHIP_ERROR DecodeRemainingAndConsume(const System::PacketBufferHandle & buf);
+
     /**
      * Encodes a header into the given buffer.
      *
@@ -498,6 +510,13 @@ private:
      */
     CHIP_ERROR DecodeFixedCommon(Encoding::LittleEndian::Reader & reader);
 
+    /**
+     * Decodes the rest of the header fields from the stream reader, which is
+     * expected to be positioned right after the fixed portion: message counter,
+     * node or group ids, and message extensions.
+     */
+    CHIP_ERROR DecodeVariable(Encoding::LittleEndian::Reader & reader);
+
     /// Represents the current encode/decode header version (4 bits)
     static constexpr uint8_t kMsgHeaderVersion = 0x00;
 
@@ -534,4 +534,46 @@ TEST(TestMessageHeader, TestMsgExtensionsDecode)
     chip::Platform::MemoryShutdown();
 }
 
+TEST(TestMessageHeader, TestPacketHeaderDecodeRemaining)
+{
+    ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+
+    for (const auto & testEntry : theTestVectorMsgExtensions)
+    {
+        System::PacketBufferHandle msg     = System::PacketBufferHandle::NewWithData(testEntry.msg, testEntry.msgLength);
+        System::PacketBufferHandle msgCopy = msg.CloneData();
+        ASSERT_FALSE(msgCopy.IsNull());
+
+        // Completing a header decoded with DecodeFixed has to give the same result as decoding it all at once.
+        PacketHeader fullHeader;
+        EXPECT_EQ(fullHeader.DecodeAndConsume(msg), CHIP_NO_ERROR);
+
+        PacketHeader header;
+        EXPECT_EQ(header.DecodeFixed(msgCopy), CHIP_NO_ERROR);
+        EXPECT_EQ(header.DecodeRemainingAndConsume(msgCopy), CHIP_NO_ERROR);
+
+        EXPECT_EQ(msgCopy->DataLength(), testEntry.msgLength - testEntry.payloadOffset);
+        EXPECT_EQ(msgCopy->DataLength(), msg->DataLength());
+        EXPECT_EQ(header.GetMessageFlags(), fullHeader.GetMessageFlags());
+        EXPECT_EQ(header.GetSecurityFlags(), fullHeader.GetSecurityFlags());
+        EXPECT_EQ(header.GetSessionId(), fullHeader.GetSessionId());
+        EXPECT_EQ(header.GetMessageCounter(), fullHeader.GetMessageCounter());
+        EXPECT_EQ(header.GetSourceNodeId(), fullHeader.GetSourceNodeId());
+        EXPECT_EQ(header.GetDestinationNodeId(), fullHeader.GetDestinationNodeId());
+        EXPECT_EQ(header.GetDestinationGroupId(), fullHeader.GetDestinationGroupId());
+    }
+
+    // A header truncated after its fixed portion fails to decode.
+    {
+        const uint8_t truncated[]      = { 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC };
+        System::PacketBufferHandle msg = System::PacketBufferHandle::NewWithData(truncated, sizeof(truncated));
+        PacketHeader header;
+        EXPECT_EQ(header.DecodeFixed(msg), CHIP_NO_ERROR);
+        EXPECT_NE(header.DecodeRemainingAndConsume(msg), CHIP_NO_ERROR);
+        EXPECT_EQ(msg->DataLength(), sizeof(truncated));
+    }
+
+    chip::Platform::MemoryShutdown();
+}
+
 } // namespace
@@ -33,6 +33,7 @@
 #include <crypto/RandUtils.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPEncoding.h>
+#include <lib/core/CHIPSafeCasts.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
@@ -202,6 +203,44 @@ public:
         SetCallback(nullptr);
     }
 
+    void MultipleMessagesTest(TCPImpl & tcp, const IPAddress & addr)
+    {
+        // A message larger than any UDP one, between two small ones: all three are queued back to back on the connection,
+        // and have to be received whole and in order.
+        static uint8_t largePayload[4000];
+        for (size_t i = 0; i < sizeof(largePayload); i++)
+        {
+            largePayload[i] = static_cast<uint8_t>(i);
+        }
+        static const ByteSpan payloads[] = { ByteSpan(Uint8::from_const_char(PAYLOAD), sizeof(PAYLOAD)), ByteSpan(largePayload),
+                                             ByteSpan(Uint8::from_const_char(PAYLOAD), sizeof(PAYLOAD)) };
+
+        SetCallback(
+            [](const uint8_t * message, size_t length, int count, void * data) {
+                const ByteSpan & expected = static_cast<const ByteSpan *>(data)[count];
+                return (length == expected.size() && memcmp(message, expected.data(), length) == 0) ? 0 : -1;
+            },
+            const_cast<void *>(static_cast<const void *>(payloads)));
+
+        for (const auto & payload : payloads)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(payload.data(), payload.size());
+            ASSERT_FALSE(buffer.IsNull());
+
+            PacketHeader header;
+            header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+            EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+
+            EXPECT_EQ(tcp.SendMessage(Transport::PeerAddress::TCP(addr, gChipTCPPort), std::move(buffer)), CHIP_NO_ERROR);
+        }
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                                 [this]() { return mReceiveHandlerCallCount == static_cast<int>(ArraySize(payloads)); });
+        EXPECT_EQ(mReceiveHandlerCallCount, static_cast<int>(ArraySize(payloads)));
+
+        SetCallback(nullptr);
+    }
+
     void ConnectTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Connect and wait for seeing active connection
@@ -487,6 +526,17 @@ protected:
         gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
     }
 
+    void ConnectSendMultipleMessagesThenCloseTest(const IPAddress & addr)
+    {
+        TCPImpl tcp;
+
+        MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+        gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+        gMockTransportMgrDelegate.ConnectTest(tcp, addr);
+        gMockTransportMgrDelegate.MultipleMessagesTest(tcp, addr);
+        gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
+    }
+
     void HandleConnCompleteTest(const IPAddress & addr)
     {
         TCPImpl tcp;
@@ -574,6 +624,13 @@ TEST_F(TestTCP, ConnectSendMessageThenCloseTest4)
     ConnectSendMessageThenCloseTest(addr);
 }
 
+TEST_F(TestTCP, ConnectSendMultipleMessagesThenCloseTest4)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    ConnectSendMultipleMessagesThenCloseTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCompleteCalledTest4)
 {
     IPAddress addr;
@@ -596,6 +653,13 @@ TEST_F(TestTCP, ConnectSendMessageThenCloseTest6)
     ConnectSendMessageThenCloseTest(addr);
 }
 
+TEST_F(TestTCP, ConnectSendMultipleMessagesThenCloseTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    ConnectSendMultipleMessagesThenCloseTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCompleteCalledTest6)
 {
     IPAddress addr;
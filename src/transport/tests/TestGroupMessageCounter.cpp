@@ -398,6 +398,48 @@ TEST(TestGroupMessageCounter, ReorderFabricRemovalTest)
     EXPECT_NE(err, CHIP_NO_ERROR);
 }
 
+TEST(TestGroupMessageCounter, PeerLookupAfterCompactionTest)
+{
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    TestGroupPeerTable mGroupPeerMsgCounter;
+
+    // Node ids that only differ in their upper half, and a counter value specific to each peer.
+    auto nodeIdAt  = [](uint32_t peer) { return (static_cast<NodeId>(peer + 1) << 32) | 0x1234; };
+    auto counterAt = [](FabricIndex fabric, uint32_t peer) { return static_cast<uint32_t>(fabric * 1000 + peer); };
+
+    for (FabricIndex fabric = 1; fabric <= 2; fabric++)
+    {
+        for (uint32_t peer = 0; peer < CHIP_CONFIG_MAX_GROUP_DATA_PEERS; peer++)
+        {
+            ASSERT_EQ(mGroupPeerMsgCounter.FindOrAddPeer(fabric, nodeIdAt(peer), false, counter), CHIP_NO_ERROR);
+            ASSERT_EQ(counter->VerifyOrTrustFirstGroup(counterAt(fabric, peer)), CHIP_NO_ERROR);
+            counter->CommitGroup(counterAt(fabric, peer));
+        }
+    }
+    EXPECT_EQ(mGroupPeerMsgCounter.FindOrAddPeer(2, nodeIdAt(CHIP_CONFIG_MAX_GROUP_DATA_PEERS), false, counter),
+              CHIP_ERROR_TOO_MANY_PEER_NODES);
+
+    // Moves the last peer of fabric 2, then fabric 2 itself.
+    EXPECT_EQ(mGroupPeerMsgCounter.RemovePeer(2, nodeIdAt(0), false), CHIP_NO_ERROR);
+    EXPECT_EQ(mGroupPeerMsgCounter.FabricRemoved(1), CHIP_NO_ERROR);
+    EXPECT_EQ(mGroupPeerMsgCounter.GetFabricIndexAt(0), 2);
+
+    // The remaining peers still find their own counter, which rejects the message already seen.
+    for (uint32_t peer = 1; peer < CHIP_CONFIG_MAX_GROUP_DATA_PEERS; peer++)
+    {
+        ASSERT_EQ(mGroupPeerMsgCounter.FindOrAddPeer(2, nodeIdAt(peer), false, counter), CHIP_NO_ERROR);
+        EXPECT_EQ(counter->VerifyOrTrustFirstGroup(counterAt(2, peer)), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+        EXPECT_EQ(counter->VerifyOrTrustFirstGroup(counterAt(2, peer) + 1), CHIP_NO_ERROR);
+    }
+
+    // Removed peers come back with a fresh counter.
+    ASSERT_EQ(mGroupPeerMsgCounter.FindOrAddPeer(2, nodeIdAt(0), false, counter), CHIP_NO_ERROR);
+    EXPECT_EQ(counter->VerifyOrTrustFirstGroup(counterAt(2, 0)), CHIP_NO_ERROR);
+    ASSERT_EQ(mGroupPeerMsgCounter.FindOrAddPeer(1, nodeIdAt(1), false, counter), CHIP_NO_ERROR);
+    EXPECT_EQ(counter->VerifyOrTrustFirstGroup(counterAt(1, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(mGroupPeerMsgCounter.GetFabricIndexAt(1), 1);
+}
+
 TEST(TestGroupMessageCounter, GroupMessageCounterTest)
 {
 
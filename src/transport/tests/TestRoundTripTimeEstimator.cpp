@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <transport/RoundTripTimeEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using chip::Transport::RoundTripTimeEstimator;
+
+TEST(TestRoundTripTimeEstimator, TestFirstSample)
+{
+    RoundTripTimeEstimator estimator;
+    EXPECT_FALSE(estimator.HasEstimate());
+
+    estimator.AddSample(100_ms32);
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSampleCount(), 1u);
+
+    // RFC 6298: SRTT = R, RTTVAR = R/2, RTO = SRTT + 4 * RTTVAR
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 50_ms32);
+    EXPECT_EQ(estimator.GetRetransTimeout(), 300_ms32);
+    EXPECT_EQ(estimator.GetMinRtt(), 100_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, TestSmoothing)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(100_ms32);
+
+    // RTTVAR = 3/4 * 50 + 1/4 * |100 - 20| = 57.5, SRTT = 7/8 * 100 + 1/8 * 20 = 90
+    estimator.AddSample(20_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 90_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 57_ms32);
+    EXPECT_EQ(estimator.GetRetransTimeout(), 320_ms32);
+    EXPECT_EQ(estimator.GetMinRtt(), 20_ms32);
+
+    // A steady round-trip time converges, with the variation decaying.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(40_ms32);
+    }
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 40_ms32);
+    EXPECT_LE(estimator.GetRttVariation(), 1_ms32);
+    EXPECT_LE(estimator.GetRetransTimeout(), 45_ms32);
+    EXPECT_EQ(estimator.GetMinRtt(), 20_ms32);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.HasEstimate());
+}
+
+} // namespace